@@ -0,0 +1,960 @@
+//
+//   Benchmarks for named_colors.h and its companion headers.  Each case is warmed up, then timed over a number of
+// repetitions.  The median and 99th percentile time per operation are reported, either as a table or as JSON so
+// that results can be compared between releases.
+//
+//   Usage:  benchmark [--reps N] [--warmup N] [--filter TEXT] [--json [FILE]]
+//
+// This file requires C++17.
+//
+
+
+#define NAMED_COLORS_ENABLE_TUPLES
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86)
+#   define NAMED_COLORS_ENABLE_SSE
+#endif
+#include "named_colors_ansi.h"
+#include "named_colors_color_spaces.h"
+#include "named_colors_contrast.h"
+#include "named_colors_cvd.h"
+#include "named_colors_delta_e.h"
+#include "named_colors_distinct.h"
+#include "named_colors_dominant.h"
+#include "named_colors_export.h"
+#include "named_colors_gpu.h"
+#include "named_colors_gradient.h"
+#include "named_colors_image.h"
+#include "named_colors_membership.h"
+#include "named_colors_oklab.h"
+#include "named_colors_palette.h"
+#include "named_colors_range_index.h"
+#include "named_colors_regions.h"
+#include "named_colors_scheduler.h"
+#include "named_colors_table.h"
+#include "named_colors_temperature.h"
+#include "named_colors_vectors.h"
+
+
+
+#include<algorithm>
+#include<array>
+#include<chrono>
+#include<cmath>
+#include<cstdint>
+#include<cstdio>
+#include<cstdlib>
+#include<cstring>
+#include<iomanip>
+#include<sstream>
+#include<string>
+#include<string_view>
+#include<thread>
+#include<tuple>
+#include<utility>
+#include<vector>
+
+
+
+namespace
+{
+    struct options
+    {
+        std::size_t reps{ 200 };
+        std::size_t warmup{ 20 };
+        std::string filter;
+        bool        json{ false };
+        std::string json_path;
+    };
+
+    struct result
+    {
+        std::string name;
+        std::size_t items;
+        std::size_t reps;
+        double      median_ns;
+        double      p99_ns;
+        double      min_ns;
+    };
+
+    //   Results of the work being timed are folded into this so it can't be optimized away.
+    volatile uint64_t sink{ 0 };
+
+    //   splitmix64, so inputs are the same on every run and every platform.
+    struct generator
+    {
+        uint64_t state;
+
+        uint64_t next()
+        {
+            uint64_t z{ state += 0x9E37'79B9'7F4A'7C15 };
+            z = ( z ^ ( z >> 30 ) ) * 0xBF58'476D'1CE4'E5B9;
+            z = ( z ^ ( z >> 27 ) ) * 0x94D0'49BB'1331'11EB;
+            return z ^ ( z >> 31 );
+        }
+
+        uint32_t color()
+        {
+            return static_cast<uint32_t>( next() ) | 0xff;
+        }
+    };
+
+
+
+    class bench
+    {
+    public:
+        explicit bench( const options& opts ) : opts_( opts ) {}
+
+        //   Times body(), which performs items operations per call.
+        template<typename Body>
+        void run( std::string_view name, std::size_t items, Body&& body )
+        {
+            if( !opts_.filter.empty() && name.find( opts_.filter ) == std::string_view::npos )
+            {
+                return;
+            }
+
+            for( std::size_t i{ 0 }; i < opts_.warmup; ++i )
+            {
+                sink = sink + body();
+            }
+
+            std::vector<double> samples( opts_.reps );
+            for( auto& sample : samples )
+            {
+                const auto start{ std::chrono::steady_clock::now() };
+                const uint64_t value{ body() };
+                const auto stop{ std::chrono::steady_clock::now() };
+                sink = sink + value;
+                sample = std::chrono::duration<double, std::nano>( stop - start ).count() / static_cast<double>( items );
+            }
+            std::sort( samples.begin(), samples.end() );
+
+            const auto percentile{ [&samples]( double p )
+            {
+                const auto index{ static_cast<std::size_t>( p * static_cast<double>( samples.size() - 1 ) + 0.5 ) };
+                return samples[index];
+            } };
+            results_.push_back( { std::string{ name }, items, samples.size(), percentile( 0.5 ), percentile( 0.99 ), samples.front() } );
+        }
+
+        void report() const
+        {
+            if( opts_.json )
+            {
+                write_json();
+                return;
+            }
+
+            std::printf( "%zu colors, %zu distinct values (dedup ratio %.3f)\n\n",
+                         named_colors::color_count, named_colors::canonical_count, named_colors::dedup_ratio );
+            std::printf( "%-32s %10s %14s %14s %14s\n", "case", "items", "median ns/op", "p99 ns/op", "min ns/op" );
+            for( const auto& r : results_ )
+            {
+                std::printf( "%-32s %10zu %14.3f %14.3f %14.3f\n", r.name.c_str(), r.items, r.median_ns, r.p99_ns, r.min_ns );
+            }
+        }
+
+    private:
+        void write_json() const
+        {
+            FILE* out{ opts_.json_path.empty() ? stdout : std::fopen( opts_.json_path.c_str(), "w" ) };
+            if( !out )
+            {
+                std::fprintf( stderr, "benchmark: can't open %s\n", opts_.json_path.c_str() );
+                std::exit( 1 );
+            }
+
+            std::fprintf( out, "{\n  \"color_count\": %zu,\n  \"canonical_count\": %zu,\n  \"dedup_ratio\": %.4f,\n"
+                               "  \"reps\": %zu,\n  \"warmup\": %zu,\n  \"results\": [\n",
+                          named_colors::color_count, named_colors::canonical_count, named_colors::dedup_ratio, opts_.reps, opts_.warmup );
+            for( std::size_t i{ 0 }; i < results_.size(); ++i )
+            {
+                const auto& r{ results_[i] };
+                std::fprintf( out, "    { \"name\": \"%s\", \"items\": %zu, \"reps\": %zu, "
+                                   "\"median_ns\": %.4f, \"p99_ns\": %.4f, \"min_ns\": %.4f }%s\n",
+                              r.name.c_str(), r.items, r.reps, r.median_ns, r.p99_ns, r.min_ns,
+                              i + 1 < results_.size() ? "," : "" );
+            }
+            std::fprintf( out, "  ]\n}\n" );
+
+            if( out != stdout )
+            {
+                std::fclose( out );
+            }
+        }
+
+        const options&      opts_;
+        std::vector<result> results_;
+    };
+
+
+
+    //   from_hex() of a table value.  With NAMED_COLORS_PREFER_ENUM it only takes a hex_color.
+    constexpr std::tuple<double, double, double, double> from_value( uint32_t value )
+    {
+#if defined(NAMED_COLORS_PREFER_ENUM)
+        return from_hex( static_cast<hex_color>( value ) );
+#else
+        return from_hex( value );
+#endif
+    }
+
+    //   The way test_app.cpp prints a color, used as the baseline for the exporter.
+    std::ostream& operator<<( std::ostream& os, const std::tuple<double, double, double, double>& color )
+    {
+        const auto& [r, g, b, a] = color;
+        return os << std::left
+            <<   "R:" << std::setw( 10 ) << r
+            << "\tG:" << std::setw( 10 ) << g
+            << "\tB:" << std::setw( 10 ) << b
+            << "\tA:" << std::setw( 10 ) << a
+            << std::right;
+    }
+
+
+
+    options parse( int argc, char** argv )
+    {
+        options opts;
+        for( int i{ 1 }; i < argc; ++i )
+        {
+            const std::string_view arg{ argv[i] };
+            const bool has_value{ i + 1 < argc && argv[i + 1][0] != '-' };
+            if( arg == "--reps" && has_value )
+            {
+                opts.reps = std::max<std::size_t>( 1, std::strtoul( argv[++i], nullptr, 10 ) );
+            }
+            else if( arg == "--warmup" && has_value )
+            {
+                opts.warmup = std::strtoul( argv[++i], nullptr, 10 );
+            }
+            else if( arg == "--filter" && has_value )
+            {
+                opts.filter = argv[++i];
+            }
+            else if( arg == "--json" )
+            {
+                opts.json = true;
+                if( has_value )
+                {
+                    opts.json_path = argv[++i];
+                }
+            }
+            else
+            {
+                std::fprintf( stderr, "usage: %s [--reps N] [--warmup N] [--filter TEXT] [--json [FILE]]\n", argv[0] );
+                std::exit( 2 );
+            }
+        }
+        return opts;
+    }
+}
+
+
+
+int main( int argc, char** argv )
+{
+    using namespace named_colors;
+
+    const auto opts{ parse( argc, argv ) };
+    bench b{ opts };
+    generator rng{ 0x6E'61'6D'65'64 };
+
+    //   Inputs shared between cases.  Sizes are chosen so a single repetition takes roughly tens of microseconds.
+    std::vector<uint32_t> named_values( 4096 );
+    std::vector<std::string_view> names( 4096 );
+    std::vector<std::string> missing_names( 4096 );
+    for( std::size_t i{ 0 }; i < names.size(); ++i )
+    {
+        const auto& e{ table[rng.next() % color_count] };
+        named_values[i] = e.value;
+        names[i] = e.name;
+        missing_names[i] = std::string{ e.name } + "_X";
+    }
+
+    std::vector<uint32_t> random_colors( 65536 );
+    for( auto& color : random_colors )
+    {
+        color = rng.color();
+    }
+
+    std::vector<float> floats( random_colors.size() * 4 );
+    std::vector<color_id> ids( random_colors.size() );
+    std::vector<color_id> random_ids( 4096 );
+    for( auto& id : random_ids )
+    {
+        id = static_cast<color_id>( rng.next() % color_count );
+    }
+
+
+    b.run( "from_hex", color_count, []
+    {
+        double sum{ 0.0 };
+        for( const auto& e : table )
+        {
+            const auto [r, g, blue, a] = from_value( e.value );
+            sum += r + g + blue + a;
+        }
+        return static_cast<uint64_t>( sum );
+    } );
+
+    b.run( "find/hit", names.size(), [&]
+    {
+        uint64_t sum{ 0 };
+        for( const auto name : names )
+        {
+            sum += find( name );
+        }
+        return sum;
+    } );
+
+    b.run( "find/miss", missing_names.size(), [&]
+    {
+        uint64_t sum{ 0 };
+        for( const auto& name : missing_names )
+        {
+            sum += find( name );
+        }
+        return sum;
+    } );
+
+    b.run( "name_of/hit", named_values.size(), [&]
+    {
+        uint64_t sum{ 0 };
+        for( const auto value : named_values )
+        {
+            sum += name_of( value ).size();
+        }
+        return sum;
+    } );
+
+    b.run( "name_of/random", 4096, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            sum += name_of( random_colors[i] ).size();
+        }
+        return sum;
+    } );
+
+    //   The same search over 0xRRGGBBAA values, i.e. the layout before canonical_rgb.
+    b.run( "nearest/rgba32", 1024, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 1024; ++i )
+        {
+            std::size_t best{ 0 };
+            uint32_t best_distance{ ~uint32_t{ 0 } };
+            for( std::size_t c{ 0 }; c < canonical_count; ++c )
+            {
+                const auto distance{ distance_squared( random_colors[i], canonical_values[c] ) };
+                if( distance < best_distance )
+                {
+                    best = c;
+                    best_distance = distance;
+                }
+            }
+            sum += canonical_ids[best];
+        }
+        return sum;
+    } );
+
+    b.run( "nearest/scalar", 1024, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 1024; ++i )
+        {
+            sum += nearest( random_colors[i] );
+        }
+        return sum;
+    } );
+
+    b.run( "nearest/batch", 1024, [&]
+    {
+        nearest( random_colors.data(), 1024, ids.data() );
+        return static_cast<uint64_t>( ids[0] + ids[1023] );
+    } );
+
+    //   The same colors as interleaved R, G, B bytes, as mapped_image hands them out.
+    std::vector<uint8_t> rgb8( random_colors.size() * 3 );
+    for( std::size_t i{ 0 }; i < random_colors.size(); ++i )
+    {
+        rgb8[i * 3 + 0] = red( random_colors[i] );
+        rgb8[i * 3 + 1] = green( random_colors[i] );
+        rgb8[i * 3 + 2] = blue( random_colors[i] );
+    }
+    b.run( "nearest/rgb8", 1024, [&]
+    {
+        nearest( rgb8.data(), 1024, 3, ids.data() );
+        return static_cast<uint64_t>( ids[0] + ids[1023] );
+    } );
+
+    constexpr auto sixteen{ make_palette(
+        hex_color::BLACK, hex_color::WHITE, hex_color::RED_PIGMENT, hex_color::ORANGE_PANTONE,
+        hex_color::YELLOW_MUNSELL, hex_color::GREEN_PIGMENT, hex_color::TEAL, hex_color::CYAN_PROCESS,
+        hex_color::BLUE_PIGMENT, hex_color::NAVY_BLUE, hex_color::PURPLE_X11, hex_color::MAGENTA_PROCESS,
+        hex_color::BROWN, hex_color::GRAY_X11, hex_color::PINK, hex_color::GOLD_METALLIC ) };
+    const std::vector<uint32_t> sixteen_values( sixteen.values().begin(), sixteen.values().end() );
+    std::vector<uint8_t> indices( random_colors.size() );
+    b.run( "palette/16/loop", random_colors.size(), [&]
+    {
+        for( std::size_t i{ 0 }; i < random_colors.size(); ++i )
+        {
+            std::size_t best{ 0 };
+            for( std::size_t c{ 1 }; c < sixteen_values.size(); ++c )
+            {
+                if( distance_squared( random_colors[i], sixteen_values[c] ) < distance_squared( random_colors[i], sixteen_values[best] ) )
+                {
+                    best = c;
+                }
+            }
+            indices[i] = static_cast<uint8_t>( best );
+        }
+        return static_cast<uint64_t>( indices[0] + indices[indices.size() - 1] );
+    } );
+
+    b.run( "palette/16/nearest", random_colors.size(), [&]
+    {
+        for( std::size_t i{ 0 }; i < random_colors.size(); ++i )
+        {
+            indices[i] = static_cast<uint8_t>( sixteen.nearest( random_colors[i] ) );
+        }
+        return static_cast<uint64_t>( indices[0] + indices[indices.size() - 1] );
+    } );
+
+    b.run( "palette/16/quantize", random_colors.size(), [&]
+    {
+        sixteen.quantize( random_colors.data(), random_colors.size(), indices.data() );
+        return static_cast<uint64_t>( indices[0] + indices[indices.size() - 1] );
+    } );
+
+    //   A batch of mixed sizes: 128 thumbnails of 16 to 256 pixels and one image of 16384, all random colors.
+    std::vector<std::vector<uint32_t>> batch_images;
+    for( std::size_t i{ 0 }; i < 128; ++i )
+    {
+        batch_images.emplace_back( 16 + rng.next() % 241 );
+    }
+    batch_images.emplace_back( 16384 );
+    std::vector<image_span> batch_spans;
+    std::vector<std::vector<color_id>> batch_ids;
+    std::vector<color_id*> batch_id_pointers;
+    std::size_t batch_pixels{ 0 };
+    for( auto& image : batch_images )
+    {
+        for( auto& color : image )
+        {
+            color = rng.color();
+        }
+        batch_spans.push_back( { image.data(), image.size() } );
+        batch_ids.emplace_back( image.size() );
+        batch_id_pointers.push_back( batch_ids.back().data() );
+        batch_pixels += image.size();
+    }
+
+    b.run( "batch/mixed/serial", batch_pixels, [&]
+    {
+        for( std::size_t i{ 0 }; i < batch_spans.size(); ++i )
+        {
+            nearest( batch_spans[i].colors, batch_spans[i].count, batch_id_pointers[i] );
+        }
+        return static_cast<uint64_t>( batch_ids.back()[0] );
+    } );
+
+    b.run( "batch/mixed/thread_per_image", batch_pixels, [&]
+    {
+        std::vector<std::thread> threads;
+        for( std::size_t i{ 0 }; i < batch_spans.size(); ++i )
+        {
+            threads.emplace_back( [&, i] { nearest( batch_spans[i].colors, batch_spans[i].count, batch_id_pointers[i] ); } );
+        }
+        for( auto& thread : threads )
+        {
+            thread.join();
+        }
+        return static_cast<uint64_t>( batch_ids.back()[0] );
+    } );
+
+    std::vector<std::size_t> thread_counts{ 1, 2, 4 };
+    if( std::thread::hardware_concurrency() > 4 )
+    {
+        thread_counts.push_back( std::thread::hardware_concurrency() );
+    }
+    for( const auto threads : thread_counts )
+    {
+        work_stealing_scheduler scheduler{ threads };
+        b.run( "batch/mixed/stealing_" + std::to_string( threads ), batch_pixels, [&]
+        {
+            nearest( scheduler, batch_spans.data(), batch_spans.size(), batch_id_pointers.data() );
+            return static_cast<uint64_t>( batch_ids.back()[0] );
+        } );
+    }
+
+    //   One pixel in eight is a named color, the rest are random.
+    std::vector<uint32_t> pixels( random_colors );
+    for( std::size_t i{ 0 }; i < pixels.size(); i += 8 )
+    {
+        pixels[i] = named_values[i % named_values.size()];
+    }
+    std::vector<uint8_t> named( pixels.size() );
+    b.run( "membership/id_of", pixels.size(), [&]
+    {
+        uint64_t count{ 0 };
+        for( const auto color : pixels )
+        {
+            count += id_of( color ) != no_color;
+        }
+        return count;
+    } );
+
+    b.run( "membership/bitset", pixels.size(), [&]
+    {
+        return static_cast<uint64_t>( count_named( pixels.data(), pixels.size() ) );
+    } );
+
+    b.run( "membership/bloom", pixels.size(), [&]
+    {
+        may_be_named( pixels.data(), pixels.size(), reinterpret_cast<bool*>( named.data() ) );
+        return static_cast<uint64_t>( named[0] + named[named.size() - 1] );
+    } );
+
+    std::vector<float4> uniforms( color_count );
+    b.run( "gpu/upload/from_hex", color_count, [&]
+    {
+        for( std::size_t id{ 0 }; id < color_count; ++id )
+        {
+            const auto [r, g, blue, a] = from_value( table[id].value );
+            uniforms[id] = { static_cast<float>( r ), static_cast<float>( g ), static_cast<float>( blue ), static_cast<float>( a ) };
+        }
+        return static_cast<uint64_t>( uniforms[color_count - 1].r * 255.0f );
+    } );
+
+    b.run( "gpu/upload/memcpy", color_count, [&]
+    {
+        std::memcpy( uniforms.data(), gpu_palette.data(), sizeof( gpu_palette ) );
+        return static_cast<uint64_t>( uniforms[color_count - 1].r * 255.0f );
+    } );
+
+#if defined(NAMED_COLORS_ENABLE_SSE)
+    b.run( "vectors/m128/from_tuple", 4096, [&]
+    {
+        __m128 sum{ _mm_setzero_ps() };
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            const auto [r, g, blue, a] = from_value( table[random_ids[i]].value );
+            sum = _mm_add_ps( sum, _mm_set_ps( static_cast<float>( a ), static_cast<float>( blue ), static_cast<float>( g ), static_cast<float>( r ) ) );
+        }
+        return static_cast<uint64_t>( _mm_cvtss_f32( sum ) );
+    } );
+
+    b.run( "vectors/m128/as_m128", 4096, [&]
+    {
+        __m128 sum{ _mm_setzero_ps() };
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            sum = _mm_add_ps( sum, as_m128( random_ids[i] ) );
+        }
+        return static_cast<uint64_t>( _mm_cvtss_f32( sum ) );
+    } );
+#endif
+
+    b.run( "to_float4/bulk", random_colors.size(), [&]
+    {
+        to_float4( random_colors.data(), random_colors.size(), floats.data() );
+        return static_cast<uint64_t>( floats[0] + floats.back() );
+    } );
+
+    b.run( "contrast/ratio", 4096, [&]
+    {
+        double sum{ 0.0 };
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            sum += contrast_ratio( random_colors[i], named_values[i] );
+        }
+        return static_cast<uint64_t>( sum );
+    } );
+
+    b.run( "contrast/best", 4096, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            sum += best_contrast( random_colors[i] );
+        }
+        return sum;
+    } );
+
+    b.run( "contrast/meeting_4.5/scan", 256, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 256; ++i )
+        {
+            for( const auto& e : table )
+            {
+                sum += contrast_ratio( random_colors[i], e.value ) >= 4.5;
+            }
+        }
+        return sum;
+    } );
+
+    b.run( "contrast/meeting_4.5/index", 256, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 256; ++i )
+        {
+            sum += meeting_contrast( random_colors[i], 4.5 ).size();
+        }
+        return sum;
+    } );
+
+    //   "Named blues lighter than L=70", and a narrow lightness band.
+    lch_box blues;
+    blues.l_min = 70.0;
+    blues.c_min = 20.0;
+    blues.h_from = 240.0;
+    blues.h_to = 290.0;
+
+    b.run( "range/box/scan", 1, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t id{ 0 }; id < color_count; ++id )
+        {
+            sum += contains( blues, lch_table[id] );
+        }
+        return sum;
+    } );
+
+    b.run( "range/box/index", 1, [&]
+    {
+        return static_cast<uint64_t>( count_in_box( blues ) );
+    } );
+
+    b.run( "range/lightness/index", 1, []
+    {
+        return static_cast<uint64_t>( lightness_range( 50.0, 55.0 ).size() );
+    } );
+
+    std::vector<oklab> normal( color_count );
+    std::vector<oklab> seen( color_count );
+    for( std::size_t id{ 0 }; id < color_count; ++id )
+    {
+        normal[id] = to_oklab( table[id].value );
+        seen[id] = to_oklab( simulated_table<cvd_model::machado, deficiency::deuteranopia>[id] );
+    }
+    b.run( "cvd/confusable/brute_force", 1, [&]
+    {
+        const auto distance{ []( const oklab& lhs, const oklab& rhs )
+        {
+            return std::sqrt( ( lhs.l - rhs.l ) * ( lhs.l - rhs.l ) + ( lhs.a - rhs.a ) * ( lhs.a - rhs.a ) + ( lhs.b - rhs.b ) * ( lhs.b - rhs.b ) );
+        } };
+        uint64_t count{ 0 };
+        for( std::size_t i{ 0 }; i < color_count; ++i )
+        {
+            for( std::size_t j{ i + 1 }; j < color_count; ++j )
+            {
+                count += distance( seen[i], seen[j] ) < 0.02 && distance( normal[i], normal[j] ) >= 0.02;
+            }
+        }
+        return count;
+    } );
+
+    b.run( "cvd/confusable/index", 1, []
+    {
+        return static_cast<uint64_t>( confusable_pairs( deficiency::deuteranopia, 0.02f ).size() );
+    } );
+
+    b.run( "distinct/40/naive", 40, []
+    {
+        //   Recomputes every candidate's distance to every picked color for each pick.
+        std::vector<color_id> picked{ 0 };
+        while( picked.size() < 40 )
+        {
+            color_id best{ 0 };
+            float best_distance{ -1.0f };
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                float closest{ 1.0e30f };
+                for( const auto other : picked )
+                {
+                    closest = std::min( closest, oklab_distance_squared( static_cast<color_id>( id ), other ) );
+                }
+                if( closest > best_distance )
+                {
+                    best = static_cast<color_id>( id );
+                    best_distance = closest;
+                }
+            }
+            picked.push_back( best );
+        }
+        return static_cast<uint64_t>( picked.back() );
+    } );
+
+    b.run( "distinct/40/incremental", 40, []
+    {
+        std::array<color_id, 40> picked{};
+        return static_cast<uint64_t>( distinct_palette( picked.size(), {}, picked.data() ) + picked.back() );
+    } );
+
+    const auto ciede2000_matrix{ delta_e_matrix::build( delta_e_metric::ciede2000 ) };
+    std::vector<lab> labs( color_count );
+    for( std::size_t id{ 0 }; id < color_count; ++id )
+    {
+        labs[id] = to_lab( table[id].value );
+    }
+    b.run( "delta_e/ciede2000/compute", 4096, [&]
+    {
+        double sum{ 0.0 };
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            sum += ciede2000( labs[random_ids[i]], labs[random_ids[( i + 1 ) % random_ids.size()]] );
+        }
+        return static_cast<uint64_t>( sum );
+    } );
+
+    b.run( "delta_e/ciede2000/matrix", 4096, [&]
+    {
+        double sum{ 0.0 };
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            sum += ciede2000_matrix.distance( random_ids[i], random_ids[( i + 1 ) % random_ids.size()] );
+        }
+        return static_cast<uint64_t>( sum );
+    } );
+
+    b.run( "delta_e/nearest_8/scan", 16, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 16; ++i )
+        {
+            std::array<std::pair<double, color_id>, color_count> row;
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                row[id] = { ciede2000( labs[random_ids[i]], labs[id] ), static_cast<color_id>( id ) };
+            }
+            std::partial_sort( row.begin(), row.begin() + 9, row.end() );
+            sum += row[8].second;
+        }
+        return sum;
+    } );
+
+    b.run( "delta_e/nearest_8/matrix", 16, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 16; ++i )
+        {
+            sum += ciede2000_matrix.nearest( random_ids[i] )[7];
+        }
+        return sum;
+    } );
+
+    b.run( "xterm256/search", 4096, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            unsigned best{ 16 };
+            for( unsigned index{ 17 }; index < 256; ++index )
+            {
+                if( distance_squared( random_colors[i], xterm256_color( static_cast<uint8_t>( index ) ) ) <
+                    distance_squared( random_colors[i], xterm256_color( static_cast<uint8_t>( best ) ) ) )
+                {
+                    best = index;
+                }
+            }
+            sum += best;
+        }
+        return sum;
+    } );
+
+    b.run( "xterm256/arithmetic", 4096, [&]
+    {
+        uint64_t sum{ 0 };
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            sum += to_xterm256( random_colors[i] );
+        }
+        return sum;
+    } );
+
+    std::vector<color_id> frame_ids( 160 * 96 );
+    for( std::size_t i{ 0 }; i < frame_ids.size(); ++i )
+    {
+        frame_ids[i] = static_cast<color_id>( ( i / 7 ) % color_count );
+    }
+    std::string frame_text;
+    for( const auto& [name, mode] : { std::pair{ "terminal/frame/ansi16", terminal_colors::ansi16 },
+                                      std::pair{ "terminal/frame/xterm256", terminal_colors::xterm256 },
+                                      std::pair{ "terminal/frame/truecolor", terminal_colors::truecolor } } )
+    {
+        const terminal_writer writer{ mode };
+        b.run( name, frame_ids.size(), [&]
+        {
+            frame_text.clear();
+            writer.frame( frame_ids.data(), 160, 96, frame_text );
+            return static_cast<uint64_t>( frame_text.size() );
+        } );
+    }
+
+    //   What callers did before: lerp the from_hex() tuples in sRGB for each sample.
+    std::vector<uint32_t> ramp( 256 );
+    std::vector<float> ramp_floats( ramp.size() * 4 );
+    b.run( "gradient/srgb_tuples", ramp.size(), [&]
+    {
+        const auto [r0, g0, b0, a0] = from_hex( hex_color::NAVY_BLUE );
+        const auto [r1, g1, b1, a1] = from_hex( hex_color::GOLD );
+        for( std::size_t i{ 0 }; i < ramp.size(); ++i )
+        {
+            const double t{ static_cast<double>( i ) / static_cast<double>( ramp.size() - 1 ) };
+            ramp[i] = rgba( static_cast<uint8_t>( ( r0 + ( r1 - r0 ) * t ) * 255.0 + 0.5 ),
+                            static_cast<uint8_t>( ( g0 + ( g1 - g0 ) * t ) * 255.0 + 0.5 ),
+                            static_cast<uint8_t>( ( b0 + ( b1 - b0 ) * t ) * 255.0 + 0.5 ),
+                            static_cast<uint8_t>( ( a0 + ( a1 - a0 ) * t ) * 255.0 + 0.5 ) );
+        }
+        return static_cast<uint64_t>( ramp[128] );
+    } );
+
+    b.run( "gradient/oklab/packed", ramp.size(), [&]
+    {
+        const gradient navy_to_gold{ { static_cast<uint32_t>( hex_color::NAVY_BLUE ), static_cast<uint32_t>( hex_color::GOLD ) } };
+        navy_to_gold.sample( ramp.data(), ramp.size() );
+        return static_cast<uint64_t>( ramp[128] );
+    } );
+
+    b.run( "gradient/oklab/float", ramp.size(), [&]
+    {
+        const gradient navy_to_gold{ { static_cast<uint32_t>( hex_color::NAVY_BLUE ), static_cast<uint32_t>( hex_color::GOLD ) } };
+        navy_to_gold.sample( ramp_floats.data(), ramp.size() );
+        return static_cast<uint64_t>( ramp_floats[512] * 255.0f );
+    } );
+
+    //   What callers did before: convert() per color in double, then the batch converters in float.
+    std::vector<float> space_values( 4096 * 4 );
+    b.run( "spaces/rec2020_pq/scalar", 4096, [&]
+    {
+        for( std::size_t i{ 0 }; i < 4096; ++i )
+        {
+            const auto c{ convert( random_colors[i], rgb_space::rec2020_pq ) };
+            space_values[i * 3 + 0] = static_cast<float>( c.r );
+            space_values[i * 3 + 1] = static_cast<float>( c.g );
+            space_values[i * 3 + 2] = static_cast<float>( c.b );
+        }
+        return static_cast<uint64_t>( space_values[0] * 1023.0f );
+    } );
+
+    for( const auto& [name, space] : { std::pair{ "spaces/display_p3/batch", rgb_space::display_p3 },
+                                       std::pair{ "spaces/rec2020_linear/batch", rgb_space::rec2020_linear },
+                                       std::pair{ "spaces/rec2020_pq/batch", rgb_space::rec2020_pq },
+                                       std::pair{ "spaces/rec2020_hlg/batch", rgb_space::rec2020_hlg } } )
+    {
+        b.run( name, 4096, [&, space = space]
+        {
+            convert( random_colors.data(), 4096, space, space_values.data() );
+            return static_cast<uint64_t>( space_values[0] * 1023.0f );
+        } );
+    }
+
+    b.run( "spaces/cmyk/batch", 4096, [&]
+    {
+        to_cmyk( random_colors.data(), 4096, space_values.data() );
+        return static_cast<uint64_t>( space_values[3] * 255.0f );
+    } );
+
+    //   A megapixel image of four flat regions with noise, as catalogue photos mostly are.
+    const uint32_t region[]{ static_cast<uint32_t>( hex_color::NAVY_BLUE ), static_cast<uint32_t>( hex_color::GOLD ),
+                             static_cast<uint32_t>( hex_color::CRIMSON ), static_cast<uint32_t>( hex_color::WHITE ) };
+    std::vector<uint32_t> megapixel( 1024 * 1024 );
+    for( std::size_t i{ 0 }; i < megapixel.size(); ++i )
+    {
+        megapixel[i] = i % 7 == 0 ? random_colors[i % random_colors.size()] : region[( i >> 18 ) & 3];
+    }
+    dominant_color dominant[5];
+    b.run( "dominant/1mp", 1, [&]
+    {
+        return static_cast<uint64_t>( dominant_colors( megapixel.data(), megapixel.size(), dominant ) + dominant[0].id );
+    } );
+
+    //   A megapixel index image of rectangular patches, and the area of one id by scanning it against the map.
+    std::vector<color_id> index_image( 1024 * 1024 );
+    for( std::size_t i{ 0 }; i < index_image.size(); ++i )
+    {
+        index_image[i] = static_cast<color_id>( ( ( i % 1024 / 97 ) ^ ( i / 1024 / 61 ) ) % 11 );
+    }
+    b.run( "regions/encode", index_image.size(), [&]
+    {
+        return static_cast<uint64_t>( region_map::encode( index_image.data(), 1024, 1024 ).regions().size() );
+    } );
+
+    b.run( "regions/area/scan", 1, [&]
+    {
+        return static_cast<uint64_t>( std::count( index_image.begin(), index_image.end(), color_id{ 7 } ) );
+    } );
+
+    const auto index_regions{ region_map::encode( index_image.data(), 1024, 1024 ) };
+    b.run( "regions/area/map", 1, [&]
+    {
+        return index_regions.area( 7 );
+    } );
+
+    //   What callers did before: a scan of every color within the Duv limit for the closest CCT.
+    b.run( "temperature/nearest_cct/scan", 64, []
+    {
+        uint64_t sum{ 0 };
+        for( int i{ 0 }; i < 64; ++i )
+        {
+            const double mired{ 1.0e6 / ( 1500.0 + i * 150.0 ) };
+            color_id best{ no_color };
+            double best_distance{ 1.0e30 };
+            for( const auto id : canonical_ids )
+            {
+                const auto& c{ cct_table[id] };
+                const double distance{ std::fabs( 1.0e6 / c.cct - mired ) };
+                if( std::fabs( c.duv ) <= max_cct_duv && distance < best_distance )
+                {
+                    best = id;
+                    best_distance = distance;
+                }
+            }
+            sum += best;
+        }
+        return sum;
+    } );
+
+    b.run( "temperature/nearest_cct/index", 64, []
+    {
+        uint64_t sum{ 0 };
+        for( int i{ 0 }; i < 64; ++i )
+        {
+            sum += nearest_cct( 1500.0 + i * 150.0 );
+        }
+        return sum;
+    } );
+
+    b.run( "export/text/iostream", color_count, []
+    {
+        std::ostringstream os;
+        for( const auto& e : table )
+        {
+            os << std::left << std::setw( 40 ) << e.name << std::right << ":\t" << from_value( e.value ) << '\n';
+        }
+        return static_cast<uint64_t>( os.str().size() );
+    } );
+
+    std::string export_buffer( export_size( export_format::text ) * 2, '\0' );
+    const std::pair<const char*, export_format> formats[]{
+        { "export/text/to_chars", export_format::text },
+        { "export/csv/to_chars",  export_format::csv },
+        { "export/json/to_chars", export_format::json },
+        { "export/hex/to_chars",  export_format::hex } };
+    for( const auto& [name, format] : formats )
+    {
+        b.run( name, color_count, [&, format = format]
+        {
+            const char* end{ export_palette( format, export_buffer.data(), export_buffer.data() + export_buffer.size() ) };
+            return static_cast<uint64_t>( end - export_buffer.data() );
+        } );
+    }
+
+    b.report();
+    return 0;
+}
@@ -0,0 +1,50 @@
+//
+//   Generates the file named_colors::delta_e_matrix::open() maps: the quantized color difference between every two
+// distinct named color values and the K nearest values to each (8 if not given).
+//
+//   Usage:  delta_e_tool oklab|ciede2000 FILE [K]
+//
+// This file requires C++17.
+//
+
+
+#include "named_colors_delta_e.h"
+
+
+
+#include<cstdio>
+#include<cstdlib>
+#include<string_view>
+#include<utility>
+
+
+
+int main( int argc, char** argv )
+{
+    using named_colors::delta_e_metric;
+
+    constexpr std::pair<std::string_view, delta_e_metric> metrics[]{
+        { "oklab",     delta_e_metric::oklab },
+        { "ciede2000", delta_e_metric::ciede2000 } };
+
+    if( argc == 3 || argc == 4 )
+    {
+        const long k{ argc == 4 ? std::strtol( argv[3], nullptr, 10 ) : 8 };
+        for( const auto& [name, metric] : metrics )
+        {
+            if( name == argv[1] && k > 0 )
+            {
+                const auto matrix{ named_colors::delta_e_matrix::build( metric, static_cast<std::size_t>( k ) ) };
+                if( matrix.save( argv[2] ) )
+                {
+                    return 0;
+                }
+                std::fprintf( stderr, "%s: can't write %s\n", argv[0], argv[2] );
+                return 1;
+            }
+        }
+    }
+
+    std::fprintf( stderr, "usage: %s oklab|ciede2000 FILE [K]\n", argv[0] );
+    return 2;
+}
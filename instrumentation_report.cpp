@@ -0,0 +1,213 @@
+//
+//   Hot path counters of named_colors_instrumentation.h from a synthetic workload.  The headers are built with
+// NAMED_COLORS_ENABLE_INSTRUMENTATION, --colors random colors (with the named colors mixed in, as real traffic has
+// them) go through every counted path: name and exact color lookups, single and bulk nearest(), the membership
+// tests, palette::quantize(), the LCh box queries and the work stealing scheduler.  The counters are then written
+// as Prometheus text, to FILE or standard output, so the figures for probe lengths, candidates per search and
+// batch sizes can be read off without instrumenting an application first.
+//
+//   Usage:  instrumentation_report [--colors N] [--batch N] [--threads N] [--seed N] [FILE]
+//
+// This file requires C++17.
+//
+
+
+#ifndef NAMED_COLORS_ENABLE_INSTRUMENTATION
+#   define NAMED_COLORS_ENABLE_INSTRUMENTATION
+#endif
+
+#include "named_colors_instrumentation.h"
+#include "named_colors_membership.h"
+#include "named_colors_palette.h"
+#include "named_colors_range_index.h"
+#include "named_colors_scheduler.h"
+#include "named_colors_table.h"
+
+
+
+#include<algorithm>
+#include<cstdint>
+#include<cstdio>
+#include<cstdlib>
+#include<memory>
+#include<string>
+#include<string_view>
+#include<thread>
+#include<vector>
+
+
+
+namespace
+{
+    using namespace named_colors;
+
+    //   splitmix64, so a seed always gives the same colors.
+    struct generator
+    {
+        uint64_t state;
+
+        uint64_t next()
+        {
+            uint64_t z{ state += 0x9E'37'79'B9'7F'4A'7C'15 };
+            z = ( z ^ ( z >> 30 ) ) * 0xBF'58'47'6D'1C'E4'E5'B9;
+            z = ( z ^ ( z >> 27 ) ) * 0x94'D0'49'BB'13'31'11'EB;
+            return z ^ ( z >> 31 );
+        }
+    };
+
+    //   One color in eight is a named one, the rest are random opaque colors.
+    std::vector<uint32_t> make_colors( std::size_t count, uint64_t seed )
+    {
+        generator rng{ seed };
+        std::vector<uint32_t> colors( count );
+        for( auto& color : colors )
+        {
+            const uint64_t r{ rng.next() };
+            color = ( r & 7 ) == 0 ? table[( r >> 8 ) % color_count].value : ( static_cast<uint32_t>( r >> 8 ) << 8 ) | 0xFF;
+        }
+        return colors;
+    }
+
+    void lookups( const std::vector<uint32_t>& colors )
+    {
+        //   Every name, and the same names in lower case, which all miss.
+        for( std::size_t id{ 0 }; id < color_count; ++id )
+        {
+            std::string name{ table[id].name };
+            find( name );
+            std::transform( name.begin(), name.end(), name.begin(), []( char c ) { return c >= 'A' && c <= 'Z' ? static_cast<char>( c - 'A' + 'a' ) : c; } );
+            find( name );
+        }
+        for( const auto color : colors )
+        {
+            id_of( color );
+        }
+    }
+
+    void searches( const std::vector<uint32_t>& colors, std::size_t batch )
+    {
+        const std::size_t singles{ std::min<std::size_t>( colors.size(), 10'000 ) };
+        for( std::size_t i{ 0 }; i < singles; ++i )
+        {
+            nearest( colors[i] );
+        }
+
+        std::vector<color_id> ids( batch );
+        for( std::size_t first{ 0 }; first < colors.size(); first += batch )
+        {
+            nearest( colors.data() + first, std::min( batch, colors.size() - first ), ids.data() );
+        }
+    }
+
+    void membership( const std::vector<uint32_t>& colors, std::size_t batch )
+    {
+        auto named{ std::make_unique<bool[]>( batch ) };
+        for( std::size_t first{ 0 }; first < colors.size(); first += batch )
+        {
+            const std::size_t count{ std::min( batch, colors.size() - first ) };
+            is_named( colors.data() + first, count, named.get() );
+            may_be_named( colors.data() + first, count, named.get() );
+        }
+    }
+
+    void palettes( const std::vector<uint32_t>& colors, std::size_t batch )
+    {
+        constexpr auto brand{ make_palette( hex_color::NAVY_BLUE, hex_color::TEAL, hex_color::GOLD, hex_color::CRIMSON,
+                                            hex_color::WHITE, hex_color::BLACK ) };
+        std::vector<decltype( brand )::index_type> indices( batch );
+        for( std::size_t first{ 0 }; first < colors.size(); first += batch )
+        {
+            brand.quantize( colors.data() + first, std::min( batch, colors.size() - first ), indices.data() );
+        }
+    }
+
+    //   Twelve hue sectors, each at three lightness bands, of the colors with some chroma.
+    void boxes()
+    {
+        std::size_t found{ 0 };
+        for( int sector{ 0 }; sector < 12; ++sector )
+        {
+            for( int band{ 0 }; band < 3; ++band )
+            {
+                const lch_box box{ band * 33.3, ( band + 1 ) * 33.3, 10.0, 1000.0, sector * 30.0, ( sector + 1 ) * 30.0 };
+                for_each_in_box( box, [&found]( color_id ) { ++found; } );
+            }
+        }
+    }
+
+    void scheduled( const std::vector<uint32_t>& colors, std::size_t threads )
+    {
+        work_stealing_scheduler scheduler{ threads };
+        const std::size_t half{ colors.size() / 2 };
+        const image_span images[]{ { colors.data(), half }, { colors.data() + half, colors.size() - half } };
+        std::vector<color_id> first( images[0].count );
+        std::vector<color_id> second( images[1].count );
+        color_id* const ids[]{ first.data(), second.data() };
+        nearest( scheduler, images, 2, ids );
+    }
+}
+
+
+
+int main( int argc, char** argv )
+{
+    std::size_t color_total{ 1'000'000 };
+    std::size_t batch{ 4096 };
+    std::size_t threads{ std::max( 1u, std::thread::hardware_concurrency() ) };
+    uint64_t seed{ 1 };
+    const char* path{ nullptr };
+    for( int i{ 1 }; i < argc; ++i )
+    {
+        const std::string_view arg{ argv[i] };
+        const bool has_value{ i + 1 < argc };
+        if( arg == "--colors" && has_value )
+        {
+            color_total = std::strtoull( argv[++i], nullptr, 10 );
+        }
+        else if( arg == "--batch" && has_value )
+        {
+            batch = std::max<std::size_t>( 1, std::strtoull( argv[++i], nullptr, 10 ) );
+        }
+        else if( arg == "--threads" && has_value )
+        {
+            threads = std::max<std::size_t>( 1, std::strtoul( argv[++i], nullptr, 10 ) );
+        }
+        else if( arg == "--seed" && has_value )
+        {
+            seed = std::strtoull( argv[++i], nullptr, 10 );
+        }
+        else if( path == nullptr && !arg.empty() && arg[0] != '-' )
+        {
+            path = argv[i];
+        }
+        else
+        {
+            std::fprintf( stderr, "usage: %s [--colors N] [--batch N] [--threads N] [--seed N] [FILE]\n", argv[0] );
+            return 2;
+        }
+    }
+
+    const auto colors{ make_colors( color_total, seed ) };
+    instrumentation::reset();
+    lookups( colors );
+    searches( colors, batch );
+    membership( colors, batch );
+    palettes( colors, batch );
+    boxes();
+    scheduled( colors, threads );
+
+    const std::string text{ instrumentation::prometheus_text( instrumentation::snapshot() ) };
+    FILE* out{ path != nullptr ? std::fopen( path, "w" ) : stdout };
+    if( out == nullptr )
+    {
+        std::fprintf( stderr, "can't write %s\n", path );
+        return 1;
+    }
+    const bool written{ std::fputs( text.c_str(), out ) >= 0 };
+    if( out != stdout ? std::fclose( out ) != 0 || !written : std::fflush( out ) != 0 || !written )
+    {
+        std::fprintf( stderr, "can't write %s\n", path != nullptr ? path : "standard output" );
+        return 1;
+    }
+    return 0;
+}
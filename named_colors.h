@@ -30,7 +30,7 @@
 //    normalized [0.0-1.0] doubles.  (In the order R, G, B, then A.)  If these were defined but not used the compiler
 //    will likely remove them anyway however, they are really most useful like this for use in 3D graphics applications.
 // 
-//    In the future, I may make it glm::vec4's be an option as well or replace the tuples with them instead.
+//    For glm::vec4, Eigen::Vector4f, __m128 or a plain aligned float struct instead, see named_colors_vectors.h.
 //   
 //      Color names were taken from
 //    < https://en.wikipedia.org/wiki/List_of_colors:_A%E2%80%93F >,
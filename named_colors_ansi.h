@@ -0,0 +1,277 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Maps colors onto terminals that can't show 24 bit color, and writes whole frames
+// of colored cells as escape sequences.
+//
+//   to_xterm256() finds the closest color in the 6x6x6 cube and the grayscale ramp of the xterm 256 color palette
+// (indices 16 to 255) with a little arithmetic instead of a search.  Since the distance is separable per channel,
+// rounding each channel to the nearest cube level gives the closest cube color, and rounding the mean of the
+// channels gives the closest gray; the closer of the two is the answer.  The first 16 indices are skipped because
+// terminals let users change them.  to_ansi16() does use those 16, assuming xterm's default values.
+//
+//   xterm256_table and ansi16_table hold the result for every named color so rendering named colors needs no
+// search at all.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_table.h"
+
+#include<array>
+#include<charconv>
+#include<cstddef>
+#include<cstdint>
+#include<string>
+
+
+
+namespace named_colors
+{
+    //   xterm's default values for the 16 system colors.
+    inline constexpr std::array<uint32_t, 16> ansi16_palette{ {
+        0x00'00'00'ff, 0xCD'00'00'ff, 0x00'CD'00'ff, 0xCD'CD'00'ff, 0x00'00'EE'ff, 0xCD'00'CD'ff, 0x00'CD'CD'ff, 0xE5'E5'E5'ff,
+        0x7F'7F'7F'ff, 0xFF'00'00'ff, 0x00'FF'00'ff, 0xFF'FF'00'ff, 0x5C'5C'FF'ff, 0xFF'00'FF'ff, 0x00'FF'FF'ff, 0xFF'FF'FF'ff } };
+
+    namespace detail
+    {
+        constexpr uint8_t cube_levels[6]{ 0x00, 0x5F, 0x87, 0xAF, 0xD7, 0xFF };
+
+        //   Nearest of the cube levels above; the thresholds are the midpoints between them.
+        constexpr uint8_t cube_index( uint8_t channel )
+        {
+            return channel < 48 ? 0 : channel < 115 ? 1 : static_cast<uint8_t>( ( channel - 35 ) / 40 );
+        }
+    }
+
+    //   The value of any of the 256 xterm colors.
+    constexpr uint32_t xterm256_color( uint8_t index )
+    {
+        if( index < 16 )
+        {
+            return ansi16_palette[index];
+        }
+        if( index >= 232 )
+        {
+            const auto level{ static_cast<uint8_t>( 8 + 10 * ( index - 232 ) ) };
+            return rgba( level, level, level );
+        }
+        const int cube{ index - 16 };
+        return rgba( detail::cube_levels[cube / 36], detail::cube_levels[cube / 6 % 6], detail::cube_levels[cube % 6] );
+    }
+
+    //   Closest of xterm colors 16 to 255 by distance_squared().  Ties go to the cube.
+    constexpr uint8_t to_xterm256( uint32_t color )
+    {
+        const uint8_t r{ detail::cube_index( red( color ) ) };
+        const uint8_t g{ detail::cube_index( green( color ) ) };
+        const uint8_t b{ detail::cube_index( blue( color ) ) };
+        const auto cube{ static_cast<uint8_t>( 16 + 36 * r + 6 * g + b ) };
+
+        const int sum{ red( color ) + green( color ) + blue( color ) };
+        int gray_step{ ( sum - 3 * 8 + 15 ) / 30 };
+        gray_step = gray_step < 0 ? 0 : gray_step > 23 ? 23 : gray_step;
+        const auto gray{ static_cast<uint8_t>( 232 + gray_step ) };
+
+        return distance_squared( color, xterm256_color( gray ) ) < distance_squared( color, xterm256_color( cube ) ) ? gray : cube;
+    }
+
+    //   Closest of the 16 system colors, assuming xterm's defaults.  Ties go to the lower index.
+    constexpr uint8_t to_ansi16( uint32_t color )
+    {
+        uint8_t best{ 0 };
+        for( uint8_t i{ 1 }; i < 16; ++i )
+        {
+            if( distance_squared( color, ansi16_palette[i] ) < distance_squared( color, ansi16_palette[best] ) )
+            {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+
+
+    namespace detail
+    {
+        template<typename Map>
+        constexpr std::array<uint8_t, color_count> make_terminal_table( Map map )
+        {
+            std::array<uint8_t, color_count> indices{};
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                indices[id] = map( table[id].value );
+            }
+            return indices;
+        }
+    }
+
+    //   to_xterm256() and to_ansi16() of every named color, indexed by color_id.
+    inline constexpr std::array<uint8_t, color_count> xterm256_table{ detail::make_terminal_table( []( uint32_t c ) { return to_xterm256( c ); } ) };
+    inline constexpr std::array<uint8_t, color_count> ansi16_table{ detail::make_terminal_table( []( uint32_t c ) { return to_ansi16( c ); } ) };
+
+
+
+    enum class terminal_colors
+    {
+        ansi16,
+        xterm256,
+        truecolor
+    };
+
+    //   Renders frames of pixels to escape sequences.  Each line of text shows two rows of pixels by drawing an
+    // upper half block with the top pixel as the foreground color and the bottom one as the background.  Colors are
+    // only sent when they change, both are sent in one sequence when both change, and cells with the same color on
+    // top and bottom are drawn as spaces so that only the background matters.
+    class terminal_writer
+    {
+    public:
+        explicit terminal_writer( terminal_colors mode ) : mode_( mode ) {}
+
+        //   Appends width * height pixels (0xRRGGBBAA, row major) to out.
+        void frame( const uint32_t* pixels, std::size_t width, std::size_t height, std::string& out ) const
+        {
+            render( width, height, out, [this, pixels]( std::size_t i ) { return code( pixels[i] ); } );
+        }
+
+        //   Same for named colors, which uses the precomputed tables instead of mapping each pixel.
+        void frame( const color_id* ids, std::size_t width, std::size_t height, std::string& out ) const
+        {
+            render( width, height, out, [this, ids]( std::size_t i )
+            {
+                switch( mode_ )
+                {
+                case terminal_colors::ansi16:   return uint32_t{ ansi16_table[ids[i]] };
+                case terminal_colors::xterm256: return uint32_t{ xterm256_table[ids[i]] };
+                default:                        return table[ids[i]].value >> 8;
+                }
+            } );
+        }
+
+    private:
+        //   What goes into the escape sequence for a color: a palette index or 0xRRGGBB.
+        uint32_t code( uint32_t color ) const
+        {
+            switch( mode_ )
+            {
+            case terminal_colors::ansi16:   return to_ansi16( color );
+            case terminal_colors::xterm256: return to_xterm256( color );
+            default:                        return color >> 8;
+            }
+        }
+
+        static constexpr uint32_t unset{ ~uint32_t{ 0 } };
+
+        template<typename Code>
+        void render( std::size_t width, std::size_t height, std::string& out, Code pixel_code ) const
+        {
+            //   Worst case per cell is both colors as truecolor plus the three bytes of the half block.
+            out.reserve( out.size() + ( height + 1 ) / 2 * ( width * 44 + 8 ) );
+
+            for( std::size_t y{ 0 }; y < height; y += 2 )
+            {
+                uint32_t foreground{ unset };
+                uint32_t background{ unset };
+                for( std::size_t x{ 0 }; x < width; ++x )
+                {
+                    const uint32_t top{ pixel_code( y * width + x ) };
+                    const uint32_t bottom{ y + 1 < height ? pixel_code( ( y + 1 ) * width + x ) : unset };
+
+                    if( bottom == unset )
+                    {
+                        //   Odd number of rows, the last line only has a top half.
+                        if( background != unset )
+                        {
+                            out += "\x1b[49m";
+                            background = unset;
+                        }
+                        set_colors( out, foreground, top, background, background );
+                        out += "\xE2\x96\x80";
+                    }
+                    else if( top == bottom )
+                    {
+                        set_colors( out, foreground, foreground, background, bottom );
+                        out += ' ';
+                    }
+                    else
+                    {
+                        set_colors( out, foreground, top, background, bottom );
+                        out += "\xE2\x96\x80";
+                    }
+                }
+                out += "\x1b[0m\n";
+            }
+        }
+
+        void set_colors( std::string& out, uint32_t& foreground, uint32_t want_foreground, uint32_t& background, uint32_t want_background ) const
+        {
+            const bool change_foreground{ foreground != want_foreground };
+            const bool change_background{ background != want_background };
+            if( !change_foreground && !change_background )
+            {
+                return;
+            }
+
+            out += "\x1b[";
+            if( change_foreground )
+            {
+                append_color( out, want_foreground, false );
+                foreground = want_foreground;
+            }
+            if( change_background )
+            {
+                if( change_foreground )
+                {
+                    out += ';';
+                }
+                append_color( out, want_background, true );
+                background = want_background;
+            }
+            out += 'm';
+        }
+
+        void append_color( std::string& out, uint32_t color, bool background ) const
+        {
+            char digits[24];
+            char* end{ digits };
+            switch( mode_ )
+            {
+            case terminal_colors::ansi16:
+                //   30-37 and 90-97 for the foreground, 40-47 and 100-107 for the background.
+                end = std::to_chars( digits, digits + sizeof( digits ), ( color < 8 ? 30 + color : 82 + color ) + ( background ? 10 : 0 ) ).ptr;
+                break;
+            case terminal_colors::xterm256:
+                end = append_number( append_text( digits, background ? "48;5;" : "38;5;" ), color );
+                break;
+            case terminal_colors::truecolor:
+                end = append_text( digits, background ? "48;2;" : "38;2;" );
+                end = append_number( end, ( color >> 16 ) & 0xFF );
+                *end++ = ';';
+                end = append_number( end, ( color >> 8 ) & 0xFF );
+                *end++ = ';';
+                end = append_number( end, color & 0xFF );
+                break;
+            }
+            out.append( digits, end );
+        }
+
+        static char* append_text( char* out, const char* text )
+        {
+            while( *text )
+            {
+                *out++ = *text++;
+            }
+            return out;
+        }
+
+        static char* append_number( char* out, uint32_t value )
+        {
+            return std::to_chars( out, out + 3, value ).ptr;
+        }
+
+        terminal_colors mode_;
+    };
+}
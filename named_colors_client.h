@@ -0,0 +1,248 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Client for naming_daemon.cpp, a small server that answers name → color,
+// color → name and nearest named color queries for many processes over a Unix domain socket.
+//
+//   Queries are sent in batches and answered with color_ids, two bytes each, which index named_colors::table; the
+// client and daemon check on connecting that they were built from the same table, by comparing table_hash.  The daemon gathers the queries
+// of every client that is waiting and answers them together, so nearest color queries from many small requests
+// still go through one vectorized bulk search.
+//
+//      auto client{ named_colors::naming_client::connect( "/tmp/named_colors.sock" ) };
+//      std::vector<named_colors::color_id> ids( pixels.size() );
+//      if( client && client.nearest( pixels.data(), pixels.size(), ids.data() ) ) ...
+//
+//   The protocol is a stream of frames, each an 8 byte header (payload size, operation, status, item count)
+// followed by the payload, all in native byte order since both ends are on the same machine.
+//
+//   POSIX only.  Requires C++17.
+//
+
+
+
+#include "named_colors_table.h"
+
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
+#include<string_view>
+#include<vector>
+
+#include<sys/socket.h>
+#include<sys/un.h>
+#include<unistd.h>
+
+
+
+namespace named_colors
+{
+    namespace naming
+    {
+        enum class operation : uint8_t
+        {
+            hello,      //  No items.  Answered with a hello_reply.
+            find,       //  Items are names, each a uint8_t length and the bytes.  Answered with ids.
+            name_of,    //  Items are uint32_t colors.  Answered with ids, no_color if not named.
+            nearest     //  Items are uint32_t colors.  Answered with ids.
+        };
+
+        enum class status : uint8_t
+        {
+            ok,
+            bad_request
+        };
+
+        struct frame_header
+        {
+            uint32_t  size;     //  Payload bytes after this header.
+            operation op;
+            status    result;
+            uint16_t  count;    //  Items in the payload.
+        };
+        static_assert( sizeof( frame_header ) == 8 );
+
+        struct hello_reply
+        {
+            uint32_t version;
+            uint32_t colors;    //  color_count.
+            uint64_t table;     //  table_hash.
+        };
+        static_assert( sizeof( hello_reply ) == 16 );
+
+        constexpr uint32_t version{ 2 };
+        constexpr std::size_t max_items{ 65535 };
+        constexpr std::size_t max_payload{ max_items * 256 };
+
+        inline bool send_all( int fd, const void* data, std::size_t size )
+        {
+            const auto* bytes{ static_cast<const char*>( data ) };
+            while( size > 0 )
+            {
+#if defined(MSG_NOSIGNAL)
+                const auto sent{ ::send( fd, bytes, size, MSG_NOSIGNAL ) };
+#else
+                const auto sent{ ::send( fd, bytes, size, 0 ) };
+#endif
+                if( sent <= 0 )
+                {
+                    return false;
+                }
+                bytes += sent;
+                size -= static_cast<std::size_t>( sent );
+            }
+            return true;
+        }
+
+        inline bool receive_all( int fd, void* data, std::size_t size )
+        {
+            auto* bytes{ static_cast<char*>( data ) };
+            while( size > 0 )
+            {
+                const auto received{ ::recv( fd, bytes, size, 0 ) };
+                if( received <= 0 )
+                {
+                    return false;
+                }
+                bytes += received;
+                size -= static_cast<std::size_t>( received );
+            }
+            return true;
+        }
+    }
+
+
+
+    class naming_client
+    {
+    public:
+        naming_client() = default;
+
+        naming_client( naming_client&& other ) noexcept : fd_( other.fd_ )
+        {
+            other.fd_ = -1;
+        }
+
+        naming_client& operator=( naming_client&& other ) noexcept
+        {
+            if( this != &other )
+            {
+                close();
+                fd_ = other.fd_;
+                other.fd_ = -1;
+            }
+            return *this;
+        }
+
+        naming_client( const naming_client& ) = delete;
+        naming_client& operator=( const naming_client& ) = delete;
+
+        ~naming_client()
+        {
+            close();
+        }
+
+        //   Connects and checks that the daemon uses the same table.  Returns a client that converts to false if
+        // either fails.
+        static naming_client connect( const char* path )
+        {
+            naming_client client;
+            sockaddr_un address{};
+            if( std::strlen( path ) >= sizeof( address.sun_path ) )
+            {
+                return client;
+            }
+            address.sun_family = AF_UNIX;
+            std::strcpy( address.sun_path, path );
+
+            client.fd_ = ::socket( AF_UNIX, SOCK_STREAM, 0 );
+            if( client.fd_ < 0 || ::connect( client.fd_, reinterpret_cast<const sockaddr*>( &address ), sizeof( address ) ) != 0 )
+            {
+                client.close();
+                return client;
+            }
+
+            naming::hello_reply hello{};
+            const naming::frame_header request{ 0, naming::operation::hello, naming::status::ok, 0 };
+            naming::frame_header response{};
+            if( !naming::send_all( client.fd_, &request, sizeof( request ) ) ||
+                !naming::receive_all( client.fd_, &response, sizeof( response ) ) ||
+                response.result != naming::status::ok || response.size != sizeof( hello ) ||
+                !naming::receive_all( client.fd_, &hello, sizeof( hello ) ) ||
+                hello.version != naming::version || hello.colors != color_count || hello.table != table_hash )
+            {
+                client.close();
+            }
+            return client;
+        }
+
+        explicit operator bool() const { return fd_ >= 0; }
+
+        //   Each of these writes count ids and returns false if the connection failed, in which case the client
+        // should be discarded.  count is at most naming::max_items.
+        bool find( const std::string_view* names, std::size_t count, color_id* ids )
+        {
+            request_.clear();
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                const auto length{ names[i].size() < 255 ? names[i].size() : 255 };
+                request_.push_back( static_cast<char>( length ) );
+                request_.insert( request_.end(), names[i].data(), names[i].data() + length );
+            }
+            return call( naming::operation::find, count, ids );
+        }
+
+        bool name_of( const uint32_t* colors, std::size_t count, color_id* ids )
+        {
+            return call_with_colors( naming::operation::name_of, colors, count, ids );
+        }
+
+        bool nearest( const uint32_t* colors, std::size_t count, color_id* ids )
+        {
+            return call_with_colors( naming::operation::nearest, colors, count, ids );
+        }
+
+    private:
+        void close()
+        {
+            if( fd_ >= 0 )
+            {
+                ::close( fd_ );
+            }
+            fd_ = -1;
+        }
+
+        bool call_with_colors( naming::operation op, const uint32_t* colors, std::size_t count, color_id* ids )
+        {
+            request_.resize( count * sizeof( uint32_t ) );
+            if( count > 0 )
+            {
+                std::memcpy( request_.data(), colors, request_.size() );
+            }
+            return call( op, count, ids );
+        }
+
+        bool call( naming::operation op, std::size_t count, color_id* ids )
+        {
+            if( fd_ < 0 || count > naming::max_items )
+            {
+                return false;
+            }
+            const naming::frame_header request{ static_cast<uint32_t>( request_.size() ), op, naming::status::ok, static_cast<uint16_t>( count ) };
+            naming::frame_header response{};
+            if( !naming::send_all( fd_, &request, sizeof( request ) ) || !naming::send_all( fd_, request_.data(), request_.size() ) ||
+                !naming::receive_all( fd_, &response, sizeof( response ) ) ||
+                response.result != naming::status::ok || response.count != count || response.size != count * sizeof( color_id ) ||
+                !naming::receive_all( fd_, ids, response.size ) )
+            {
+                close();
+                return false;
+            }
+            return true;
+        }
+
+        int               fd_{ -1 };
+        std::vector<char> request_;
+    };
+}
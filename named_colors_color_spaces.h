@@ -0,0 +1,326 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Named colors in the spaces print and HDR pipelines hand them on in: Display P3,
+// Rec. 2020 linear, Rec. 2020 with the PQ or HLG curves of BT.2100, and a naive CMYK.  The values of every named
+// color are computed at compile time; space_table<space> holds one space and is only built for the spaces used.
+//
+//      const auto& p3{ named_colors::space_table<named_colors::rgb_space::display_p3> };
+//      const float red{ p3.r[ named_colors::id_of( hex_color::CRIMSON ) ] };
+//
+//   convert() and to_cmyk() do the same for arrays of any 0xRRGGBBAA colors, in blocks small enough to stay in L1:
+// decoding, the 3x3 matrix from linear sRGB to the target primaries and the target's curve are one pass, on planes
+// of floats that the compiler vectorizes.
+//
+//   The matrices are the D65 conversions from BT.709 primaries, to P3 (SMPTE EG 432-1) and to BT.2020 (BT.2087).
+// sRGB white is placed at the BT.2408 reference white: 203 cd/m² for PQ and 75% signal for HLG.  Brighter values
+// can't come from sRGB, so neither curve ever reaches its peak.  The CMYK is the device independent formula
+// K = 1 - max( R, G, B ) on the sRGB values with no ink limits or profile, the usual starting point for proofing.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<array>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+
+
+
+namespace named_colors
+{
+    enum class rgb_space
+    {
+        display_p3,         //  P3 primaries, sRGB curve.
+        rec2020_linear,     //  BT.2020 primaries, no curve, sRGB white is 1.
+        rec2020_pq,         //  BT.2020 primaries, BT.2100 PQ curve.
+        rec2020_hlg         //  BT.2020 primaries, BT.2100 HLG curve.
+    };
+
+    //   Normalized R, G, B of one of the rgb_space spaces.
+    struct wide_rgb
+    {
+        double r;
+        double g;
+        double b;
+    };
+
+    struct cmyk
+    {
+        double c;
+        double m;
+        double y;
+        double k;
+    };
+
+
+
+    //   PQ signal of linear light with 1 at the 203 cd/m² reference white.
+    constexpr double linear_to_pq( double linear )
+    {
+        constexpr double m1{ 2610.0 / 16384.0 };
+        constexpr double m2{ 2523.0 / 4096.0 * 128.0 };
+        constexpr double c1{ 3424.0 / 4096.0 };
+        constexpr double c2{ 2413.0 / 4096.0 * 32.0 };
+        constexpr double c3{ 2392.0 / 4096.0 * 32.0 };
+        const double y{ detail::pow( std::clamp( linear * 203.0 / 10000.0, 0.0, 1.0 ), m1 ) };
+        return detail::pow( ( c1 + c2 * y ) / ( 1.0 + c3 * y ), m2 );
+    }
+
+    namespace detail
+    {
+        constexpr double hlg_a{ 0.17883277 };
+        constexpr double hlg_b{ 1.0 - 4.0 * hlg_a };
+        constexpr double hlg_c{ 0.55991073 };
+
+        //   Scene light that the HLG curve takes to 75%.
+        constexpr double hlg_reference_white{ ( exp( ( 0.75 - hlg_c ) / hlg_a ) + hlg_b ) / 12.0 };
+    }
+
+    //   HLG signal of linear light with 1 at the reference white.
+    constexpr double linear_to_hlg( double linear )
+    {
+        const double e{ std::clamp( linear * detail::hlg_reference_white, 0.0, 1.0 ) };
+        return e <= 1.0 / 12.0 ? detail::sqrt( 3.0 * e ) : detail::hlg_a * detail::log( 12.0 * e - detail::hlg_b ) + detail::hlg_c;
+    }
+
+    namespace detail
+    {
+        //   Linear sRGB to linear P3 and to linear BT.2020, row major.
+        constexpr std::array<double, 9> srgb_to_p3{
+            0.8224621, 0.1775380, 0.0000000,
+            0.0331941, 0.9668058, 0.0000000,
+            0.0170827, 0.0723974, 0.9105199 };
+
+        constexpr std::array<double, 9> srgb_to_rec2020{
+            0.6274039, 0.3292830, 0.0433131,
+            0.0690973, 0.9195404, 0.0113623,
+            0.0163914, 0.0880133, 0.8955953 };
+
+        constexpr const std::array<double, 9>& primaries_matrix( rgb_space space )
+        {
+            return space == rgb_space::display_p3 ? srgb_to_p3 : srgb_to_rec2020;
+        }
+
+        constexpr double encode( rgb_space space, double linear )
+        {
+            switch( space )
+            {
+            case rgb_space::display_p3:
+                return linear_to_srgb( std::clamp( linear, 0.0, 1.0 ) );
+            case rgb_space::rec2020_pq:
+                return linear_to_pq( linear );
+            case rgb_space::rec2020_hlg:
+                return linear_to_hlg( linear );
+            default:
+                return std::clamp( linear, 0.0, 1.0 );
+            }
+        }
+    }
+
+    //   0xRRGGBBAA in space; alpha is ignored.
+    constexpr wide_rgb convert( uint32_t color, rgb_space space )
+    {
+        const auto c{ to_linear( color ) };
+        const auto& m{ detail::primaries_matrix( space ) };
+        return {
+            detail::encode( space, m[0] * c.r + m[1] * c.g + m[2] * c.b ),
+            detail::encode( space, m[3] * c.r + m[4] * c.g + m[5] * c.b ),
+            detail::encode( space, m[6] * c.r + m[7] * c.g + m[8] * c.b ) };
+    }
+
+    constexpr cmyk to_cmyk( uint32_t color )
+    {
+        const double r{ red( color ) / 255.0 };
+        const double g{ green( color ) / 255.0 };
+        const double b{ blue( color ) / 255.0 };
+        const double k{ 1.0 - std::max( { r, g, b } ) };
+        if( k >= 1.0 )
+        {
+            return { 0.0, 0.0, 0.0, 1.0 };
+        }
+        return { ( 1.0 - r - k ) / ( 1.0 - k ), ( 1.0 - g - k ) / ( 1.0 - k ), ( 1.0 - b - k ) / ( 1.0 - k ), k };
+    }
+
+
+
+    template<std::size_t N>
+    struct space_planes
+    {
+        alignas( 32 ) std::array<float, N> r;
+        alignas( 32 ) std::array<float, N> g;
+        alignas( 32 ) std::array<float, N> b;
+    };
+
+    template<std::size_t N>
+    struct cmyk_planes
+    {
+        alignas( 32 ) std::array<float, N> c;
+        alignas( 32 ) std::array<float, N> m;
+        alignas( 32 ) std::array<float, N> y;
+        alignas( 32 ) std::array<float, N> k;
+    };
+
+    namespace detail
+    {
+        constexpr space_planes<color_count> make_space_table( rgb_space space )
+        {
+            space_planes<color_count> planes{};
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                const auto c{ convert( table[id].value, space ) };
+                planes.r[id] = static_cast<float>( c.r );
+                planes.g[id] = static_cast<float>( c.g );
+                planes.b[id] = static_cast<float>( c.b );
+            }
+            return planes;
+        }
+
+        constexpr cmyk_planes<color_count> make_cmyk_table()
+        {
+            cmyk_planes<color_count> planes{};
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                const auto c{ to_cmyk( table[id].value ) };
+                planes.c[id] = static_cast<float>( c.c );
+                planes.m[id] = static_cast<float>( c.m );
+                planes.y[id] = static_cast<float>( c.y );
+                planes.k[id] = static_cast<float>( c.k );
+            }
+            return planes;
+        }
+    }
+
+    //   convert() of every named color, indexed by color_id.
+    template<rgb_space Space>
+    inline constexpr space_planes<color_count> space_table{ detail::make_space_table( Space ) };
+
+    //   to_cmyk() of every named color, indexed by color_id.
+    inline constexpr cmyk_planes<color_count> cmyk_table{ detail::make_cmyk_table() };
+
+
+
+    namespace detail
+    {
+        constexpr std::size_t space_block{ 256 };
+
+        constexpr std::array<float, 256> make_linear_table_f()
+        {
+            std::array<float, 256> values{};
+            for( std::size_t i{ 0 }; i < values.size(); ++i )
+            {
+                values[i] = static_cast<float>( linear_table[i] );
+            }
+            return values;
+        }
+
+        inline constexpr std::array<float, 256> linear_table_f{ make_linear_table_f() };
+
+        //   The runtime curves, in float.
+        inline void encode( rgb_space space, float* values, std::size_t n )
+        {
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                values[i] = std::clamp( values[i], 0.0f, 1.0f );
+            }
+            switch( space )
+            {
+            case rgb_space::display_p3:
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    values[i] = values[i] <= 0.0031308f ? values[i] * 12.92f : 1.055f * std::pow( values[i], 1.0f / 2.4f ) - 0.055f;
+                }
+                break;
+            case rgb_space::rec2020_pq:
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    const float y{ std::pow( values[i] * ( 203.0f / 10000.0f ), 2610.0f / 16384.0f ) };
+                    values[i] = std::pow( ( 3424.0f / 4096.0f + 2413.0f / 128.0f * y ) / ( 1.0f + 2392.0f / 128.0f * y ), 2523.0f / 32.0f );
+                }
+                break;
+            case rgb_space::rec2020_hlg:
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    const float e{ std::min( values[i] * static_cast<float>( hlg_reference_white ), 1.0f ) };
+                    values[i] = e <= 1.0f / 12.0f ? std::sqrt( 3.0f * e )
+                                                  : static_cast<float>( hlg_a ) * std::log( 12.0f * e - static_cast<float>( hlg_b ) ) + static_cast<float>( hlg_c );
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    //   Writes count * 3 floats, R, G, B in space for each of colors.  Alpha is ignored.
+    inline void convert( const uint32_t* colors, std::size_t count, rgb_space space, float* rgb )
+    {
+        const auto& decode{ detail::linear_table_f };
+        const auto& matrix{ detail::primaries_matrix( space ) };
+        float m[9];
+        for( std::size_t i{ 0 }; i < 9; ++i )
+        {
+            m[i] = static_cast<float>( matrix[i] );
+        }
+
+        alignas( 32 ) float lr[detail::space_block];
+        alignas( 32 ) float lg[detail::space_block];
+        alignas( 32 ) float lb[detail::space_block];
+        alignas( 32 ) float r[detail::space_block];
+        alignas( 32 ) float g[detail::space_block];
+        alignas( 32 ) float b[detail::space_block];
+        for( std::size_t first{ 0 }; first < count; first += detail::space_block )
+        {
+            const std::size_t n{ std::min( detail::space_block, count - first ) };
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                const uint32_t c{ colors[first + i] };
+                lr[i] = decode[c >> 24];
+                lg[i] = decode[( c >> 16 ) & 0xFF];
+                lb[i] = decode[( c >> 8 ) & 0xFF];
+            }
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                r[i] = m[0] * lr[i] + m[1] * lg[i] + m[2] * lb[i];
+                g[i] = m[3] * lr[i] + m[4] * lg[i] + m[5] * lb[i];
+                b[i] = m[6] * lr[i] + m[7] * lg[i] + m[8] * lb[i];
+            }
+            detail::encode( space, r, n );
+            detail::encode( space, g, n );
+            detail::encode( space, b, n );
+
+            float* out{ rgb + first * 3 };
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                out[i * 3 + 0] = r[i];
+                out[i * 3 + 1] = g[i];
+                out[i * 3 + 2] = b[i];
+            }
+        }
+    }
+
+    //   Writes count * 4 floats, C, M, Y, K for each of colors.
+    inline void to_cmyk( const uint32_t* colors, std::size_t count, float* values )
+    {
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            const uint32_t color{ colors[i] };
+            const float r{ static_cast<float>( color >> 24 ) / 255.0f };
+            const float g{ static_cast<float>( ( color >> 16 ) & 0xFF ) / 255.0f };
+            const float b{ static_cast<float>( ( color >> 8 ) & 0xFF ) / 255.0f };
+            const float white{ std::max( r, std::max( g, b ) ) };
+            const float scale{ white > 0.0f ? 1.0f / white : 0.0f };
+            values[i * 4 + 0] = ( white - r ) * scale;
+            values[i * 4 + 1] = ( white - g ) * scale;
+            values[i * 4 + 2] = ( white - b ) * scale;
+            values[i * 4 + 3] = 1.0f - white;
+        }
+    }
+}
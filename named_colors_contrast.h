@@ -0,0 +1,134 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Relative luminance and contrast ratios as defined by WCAG 2, precomputed for
+// every named color, with queries for picking readable colors against a background.
+//
+//   The named colors are also kept in an index sorted by luminance.  For a given background, the colors meeting a
+// contrast ratio are always a run of the darkest colors plus a run of the lightest ones, so finding all of them is
+// two binary searches and the result is returned as two spans into the index.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<array>
+#include<cstddef>
+#include<cstdint>
+
+
+
+namespace named_colors
+{
+    constexpr double relative_luminance( uint32_t color )
+    {
+        return 0.2126 * linear_table[red( color )] + 0.7152 * linear_table[green( color )] + 0.0722 * linear_table[blue( color )];
+    }
+
+    //   Ratio between 1 and 21, the order of the arguments doesn't matter.
+    constexpr double luminance_contrast( double lhs, double rhs )
+    {
+        return lhs > rhs ? ( lhs + 0.05 ) / ( rhs + 0.05 ) : ( rhs + 0.05 ) / ( lhs + 0.05 );
+    }
+
+    constexpr double contrast_ratio( uint32_t lhs, uint32_t rhs )
+    {
+        return luminance_contrast( relative_luminance( lhs ), relative_luminance( rhs ) );
+    }
+
+
+
+    namespace detail
+    {
+        constexpr std::array<double, color_count> make_luminance_table()
+        {
+            std::array<double, color_count> luminance{};
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                luminance[id] = relative_luminance( table[id].value );
+            }
+            return luminance;
+        }
+    }
+
+    //   relative_luminance() of every named color, indexed by color_id.
+    inline constexpr std::array<double, color_count> luminance_table{ detail::make_luminance_table() };
+
+    namespace detail
+    {
+        constexpr std::array<color_id, canonical_count> make_luminance_order()
+        {
+            std::array<color_id, canonical_count> ids{ canonical_ids };
+            sort_ids( ids, []( color_id lhs, color_id rhs )
+            {
+                return luminance_table[lhs] < luminance_table[rhs] || ( luminance_table[lhs] == luminance_table[rhs] && lhs < rhs );
+            } );
+            return ids;
+        }
+
+        constexpr std::array<double, canonical_count> make_sorted_luminance( const std::array<color_id, canonical_count>& order )
+        {
+            std::array<double, canonical_count> sorted{};
+            for( std::size_t i{ 0 }; i < canonical_count; ++i )
+            {
+                sorted[i] = luminance_table[order[i]];
+            }
+            return sorted;
+        }
+    }
+
+    //   Every canonical id, darkest first.
+    inline constexpr std::array<color_id, canonical_count> luminance_order{ detail::make_luminance_order() };
+
+    //   luminance_table in luminance_order, so the searches below only touch one contiguous array.
+    inline constexpr std::array<double, canonical_count> sorted_luminance{ detail::make_sorted_luminance( luminance_order ) };
+
+
+
+    //   The named color with the highest contrast against background.  That is always either the darkest or the
+    // lightest named color.
+    constexpr color_id best_contrast( uint32_t background )
+    {
+        const double luminance{ relative_luminance( background ) };
+        return luminance_contrast( luminance, sorted_luminance.front() ) >= luminance_contrast( luminance, sorted_luminance.back() )
+            ? luminance_order.front()
+            : luminance_order.back();
+    }
+
+    struct contrast_matches
+    {
+        id_span darker;     //  Darker than the background, darkest first.
+        id_span lighter;    //  At least as light as the background, darkest first.
+
+        constexpr std::size_t size() const { return darker.size() + lighter.size(); }
+    };
+
+    //   Every named color whose contrast ratio against background is at least minimum_ratio, aliases only once.
+    // Uses exactly the same arithmetic as contrast_ratio() so the result agrees with checking each color one at a
+    // time.
+    inline contrast_matches meeting_contrast( uint32_t background, double minimum_ratio )
+    {
+        const double luminance{ relative_luminance( background ) };
+        const auto first{ sorted_luminance.begin() };
+        const auto last{ sorted_luminance.end() };
+        const auto meets{ [luminance, minimum_ratio]( double other )
+        {
+            return luminance_contrast( luminance, other ) >= minimum_ratio;
+        } };
+
+        const auto split{ std::lower_bound( first, last, luminance ) };
+        const auto darker_end{ std::partition_point( first, split, meets ) };
+        const auto lighter_begin{ std::partition_point( split, last, [&meets]( double other ) { return !meets( other ); } ) };
+
+        const color_id* const ids{ luminance_order.data() };
+        return {
+            { ids, ids + ( darker_end - first ) },
+            { ids + ( lighter_begin - first ), ids + canonical_count } };
+    }
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Simulates how colors look with protanopia, deuteranopia and tritanopia, and finds
+// pairs of named colors that can be told apart with normal vision but not with one of those deficiencies.
+//
+//   Two models are available.  Machado, Oliveira and Fernandes (2009) at full severity is a single matrix in linear
+// RGB.  Brettel, Viénot and Mollon (1997) projects onto one of two half planes depending on which side of a
+// separating plane the color is; the matrices are the linear RGB form published with libDaltonLens.
+//
+//   simulated_table<model, deficiency> holds the simulated value of every named color and is computed at compile
+// time, only for the combinations that are used.
+//
+//   confusable_pairs() compares simulated colors in OKLab.  The colors are kept sorted by OKLab lightness, so each
+// color is only compared with the few whose lightness is within the threshold instead of with all of them.  The
+// sorted index is built the first time a given model and deficiency is queried.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<array>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+#include<vector>
+
+
+
+namespace named_colors
+{
+    enum class deficiency
+    {
+        protanopia,
+        deuteranopia,
+        tritanopia
+    };
+
+    enum class cvd_model
+    {
+        machado,
+        brettel
+    };
+
+
+
+    namespace detail
+    {
+        using matrix3 = std::array<double, 9>;
+
+        constexpr linear_rgb multiply( const matrix3& m, const linear_rgb& c )
+        {
+            return {
+                m[0] * c.r + m[1] * c.g + m[2] * c.b,
+                m[3] * c.r + m[4] * c.g + m[5] * c.b,
+                m[6] * c.r + m[7] * c.g + m[8] * c.b };
+        }
+
+        constexpr matrix3 machado_matrix( deficiency type )
+        {
+            switch( type )
+            {
+            case deficiency::protanopia:
+                return { 0.152286,  1.052583, -0.204868,
+                         0.114503,  0.786281,  0.099216,
+                        -0.003882, -0.048116,  1.051998 };
+            case deficiency::deuteranopia:
+                return { 0.367322,  0.860646, -0.227968,
+                         0.280085,  0.672501,  0.047413,
+                        -0.011820,  0.042940,  0.968881 };
+            default:
+                return { 1.255528, -0.076749, -0.178779,
+                        -0.078411,  0.930809,  0.147602,
+                         0.004733,  0.691367,  0.303900 };
+            }
+        }
+
+        struct brettel_parameters
+        {
+            matrix3    first;
+            matrix3    second;
+            linear_rgb separation;
+        };
+
+        constexpr brettel_parameters brettel( deficiency type )
+        {
+            switch( type )
+            {
+            case deficiency::protanopia:
+                return { { 0.14980,  1.19548, -0.34528,
+                           0.10764,  0.84864,  0.04372,
+                           0.00384, -0.00540,  1.00156 },
+                         { 0.14570,  1.16172, -0.30742,
+                           0.10816,  0.85291,  0.03892,
+                           0.00386, -0.00524,  1.00139 },
+                         { 0.00048,  0.00393, -0.00441 } };
+            case deficiency::deuteranopia:
+                return { { 0.36477,  0.86381, -0.22858,
+                           0.26294,  0.64245,  0.09462,
+                          -0.02006,  0.02728,  0.99278 },
+                         { 0.37298,  0.88166, -0.25464,
+                           0.25954,  0.63506,  0.10540,
+                          -0.01980,  0.02784,  0.99196 },
+                         { -0.00281, -0.00611, 0.00892 } };
+            default:
+                return { { 1.01277,  0.13548, -0.14826,
+                          -0.01243,  0.86812,  0.14431,
+                           0.07589,  0.80500,  0.11911 },
+                         { 0.93678,  0.18979, -0.12657,
+                           0.06154,  0.81526,  0.12320,
+                          -0.37562,  1.12767,  1.24796 },
+                         { 0.03901, -0.02788, -0.01113 } };
+            }
+        }
+
+        constexpr double clamp01( double value )
+        {
+            return value < 0.0 ? 0.0 : value > 1.0 ? 1.0 : value;
+        }
+    }
+
+
+
+    //   Simulated color in linear RGB, clamped to [0, 1].
+    constexpr linear_rgb simulate( const linear_rgb& color, deficiency type, cvd_model model = cvd_model::machado )
+    {
+        linear_rgb simulated{};
+        if( model == cvd_model::machado )
+        {
+            simulated = detail::multiply( detail::machado_matrix( type ), color );
+        }
+        else
+        {
+            const auto p{ detail::brettel( type ) };
+            const double side{ color.r * p.separation.r + color.g * p.separation.g + color.b * p.separation.b };
+            simulated = detail::multiply( side >= 0.0 ? p.first : p.second, color );
+        }
+        return { detail::clamp01( simulated.r ), detail::clamp01( simulated.g ), detail::clamp01( simulated.b ) };
+    }
+
+    constexpr uint32_t simulate( uint32_t color, deficiency type, cvd_model model = cvd_model::machado )
+    {
+        return to_hex( simulate( to_linear( color ), type, model ), static_cast<uint8_t>( color ) );
+    }
+
+    namespace detail
+    {
+        template<cvd_model Model, deficiency Type>
+        constexpr std::array<uint32_t, color_count> make_simulated_table()
+        {
+            std::array<uint32_t, color_count> simulated{};
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                simulated[id] = simulate( table[id].value, Type, Model );
+            }
+            return simulated;
+        }
+    }
+
+    //   simulate() of every named color, indexed by color_id.
+    template<cvd_model Model, deficiency Type>
+    inline constexpr std::array<uint32_t, color_count> simulated_table{ detail::make_simulated_table<Model, Type>() };
+
+
+
+    struct confusable_pair
+    {
+        color_id first;
+        color_id second;
+        float    simulated_distance;    //  OKLab distance after simulation.
+        float    normal_distance;       //  OKLab distance with normal vision.
+    };
+
+    namespace detail
+    {
+        struct cvd_point
+        {
+            float    l;
+            float    a;
+            float    b;
+            color_id id;
+        };
+
+        struct cvd_index
+        {
+            std::vector<cvd_point> simulated;   //  Sorted by l.
+            std::array<cvd_point, color_count> normal;
+        };
+
+        inline cvd_point to_cvd_point( uint32_t color, color_id id )
+        {
+            const auto c{ to_oklab( color ) };
+            return { static_cast<float>( c.l ), static_cast<float>( c.a ), static_cast<float>( c.b ), id };
+        }
+
+        inline float oklab_distance_squared( const cvd_point& lhs, const cvd_point& rhs )
+        {
+            const float dl{ lhs.l - rhs.l };
+            const float da{ lhs.a - rhs.a };
+            const float db{ lhs.b - rhs.b };
+            return dl * dl + da * da + db * db;
+        }
+
+        template<cvd_model Model, deficiency Type>
+        const cvd_index& cvd_index_for()
+        {
+            static const auto index{ []
+            {
+                cvd_index built{};
+                for( std::size_t id{ 0 }; id < color_count; ++id )
+                {
+                    built.normal[id] = to_cvd_point( table[id].value, static_cast<color_id>( id ) );
+                }
+
+                //   Aliases would only repeat the same pairs under other names.
+                built.simulated.reserve( canonical_count );
+                for( const auto id : canonical_ids )
+                {
+                    built.simulated.push_back( to_cvd_point( simulated_table<Model, Type>[id], id ) );
+                }
+                std::sort( built.simulated.begin(), built.simulated.end(), []( const cvd_point& lhs, const cvd_point& rhs )
+                {
+                    return lhs.l < rhs.l || ( lhs.l == rhs.l && lhs.id < rhs.id );
+                } );
+                return built;
+            }() };
+            return index;
+        }
+
+        template<cvd_model Model, deficiency Type>
+        std::vector<confusable_pair> confusable_pairs( float threshold )
+        {
+            const auto& index{ cvd_index_for<Model, Type>() };
+            const auto& points{ index.simulated };
+
+            const float limit{ threshold * threshold };
+            std::vector<confusable_pair> pairs;
+            for( std::size_t i{ 0 }; i < points.size(); ++i )
+            {
+                for( std::size_t j{ i + 1 }; j < points.size() && points[j].l - points[i].l < threshold; ++j )
+                {
+                    const float simulated_distance{ oklab_distance_squared( points[i], points[j] ) };
+                    if( simulated_distance < limit )
+                    {
+                        const color_id first{ std::min( points[i].id, points[j].id ) };
+                        const color_id second{ std::max( points[i].id, points[j].id ) };
+                        const float normal_distance{ oklab_distance_squared( index.normal[first], index.normal[second] ) };
+                        if( normal_distance >= limit )
+                        {
+                            pairs.push_back( { first, second, std::sqrt( simulated_distance ), std::sqrt( normal_distance ) } );
+                        }
+                    }
+                }
+            }
+
+            //   The sweep finds pairs in lightness order.  Put them in id order with a counting sort on the first id,
+            // then sort the few pairs sharing a first id by the second.
+            std::array<std::size_t, color_count + 1> starts{};
+            for( const auto& pair : pairs )
+            {
+                ++starts[pair.first + 1];
+            }
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                starts[id + 1] += starts[id];
+            }
+            std::vector<confusable_pair> sorted( pairs.size() );
+            auto next{ starts };
+            for( const auto& pair : pairs )
+            {
+                sorted[next[pair.first]++] = pair;
+            }
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                std::sort( sorted.begin() + starts[id], sorted.begin() + starts[id + 1], []( const confusable_pair& lhs, const confusable_pair& rhs )
+                {
+                    return lhs.second < rhs.second;
+                } );
+            }
+            return sorted;
+        }
+    }
+
+    //   Pairs of distinct named color values that are at least threshold apart in OKLab with normal vision but less
+    // than threshold apart once simulated, ordered by id.  Only the first of a group of aliases is reported.  A
+    // threshold of around 0.02 to 0.05 is a reasonable "hard to tell apart".
+    template<cvd_model Model = cvd_model::machado>
+    std::vector<confusable_pair> confusable_pairs( deficiency type, float threshold )
+    {
+        switch( type )
+        {
+        case deficiency::protanopia:   return detail::confusable_pairs<Model, deficiency::protanopia>( threshold );
+        case deficiency::deuteranopia: return detail::confusable_pairs<Model, deficiency::deuteranopia>( threshold );
+        default:                       return detail::confusable_pairs<Model, deficiency::tritanopia>( threshold );
+        }
+    }
+}
@@ -0,0 +1,452 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  A precomputed table of the color difference (ΔE) between every two distinct
+// named color values, and for each value the k other values closest to it, so that "what looks like VERMILION_1"
+// is a table read.
+//
+//   Only the upper triangle is stored, quantized to 16 bits with a scale chosen so the largest difference just
+// fits.  With 896 distinct values that is about 800 KB, small enough to build at start up (around 10 ms for OKLab,
+// 100 ms for CIEDE2000) or to generate once with delta_e_tool.cpp and map from a file:
+//
+//      auto matrix{ named_colors::delta_e_matrix::open( "named_colors_ciede2000.bin" ) };
+//      for( const auto id : matrix.nearest( named_colors::find( "VERMILION_1" ) ) ) ...
+//
+//   The file is a 32 byte header, the triangle, then the nearest lists, all in native byte order.  It is only
+// valid with the table it was generated from.  The header records the table's table_hash, and open() rejects files
+// whose header doesn't match, including ones built from an edited table with as many distinct values.
+//
+//   Rows are canonical ids.  Ids are accepted for any name; aliases share the row of their canonical id, and only
+// canonical ids appear in the nearest lists.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_oklab.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<array>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
+#include<limits>
+#include<utility>
+#include<vector>
+
+#if defined(_WIN32)
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include<windows.h>
+#else
+#   include<fcntl.h>
+#   include<sys/mman.h>
+#   include<sys/stat.h>
+#   include<unistd.h>
+#endif
+
+
+
+namespace named_colors
+{
+    enum class delta_e_metric : uint32_t
+    {
+        oklab,      //  Euclidean distance in OKLab.
+        ciede2000   //  CIEDE2000 on CIE Lab, D65.
+    };
+
+    //   CIEDE2000 color difference, following Sharma, Wu and Dalal (2005).
+    inline double ciede2000( const lab& lhs, const lab& rhs )
+    {
+        constexpr double degrees{ 180.0 / detail::pi };
+        constexpr double pow25_7{ 6103515625.0 };
+
+        const double c_mean{ ( std::hypot( lhs.a, lhs.b ) + std::hypot( rhs.a, rhs.b ) ) / 2.0 };
+        const double c_mean7{ std::pow( c_mean, 7.0 ) };
+        const double g{ 0.5 * ( 1.0 - std::sqrt( c_mean7 / ( c_mean7 + pow25_7 ) ) ) };
+
+        const double a1{ ( 1.0 + g ) * lhs.a };
+        const double a2{ ( 1.0 + g ) * rhs.a };
+        const double c1{ std::hypot( a1, lhs.b ) };
+        const double c2{ std::hypot( a2, rhs.b ) };
+        const auto hue{ []( double b, double a )
+        {
+            if( a == 0.0 && b == 0.0 )
+            {
+                return 0.0;
+            }
+            const double h{ std::atan2( b, a ) * degrees };
+            return h < 0.0 ? h + 360.0 : h;
+        } };
+        const double h1{ hue( lhs.b, a1 ) };
+        const double h2{ hue( rhs.b, a2 ) };
+
+        const double delta_l{ rhs.l - lhs.l };
+        const double delta_c{ c2 - c1 };
+        double delta_h{ 0.0 };
+        if( c1 * c2 != 0.0 )
+        {
+            delta_h = h2 - h1;
+            delta_h += delta_h > 180.0 ? -360.0 : delta_h < -180.0 ? 360.0 : 0.0;
+        }
+        const double delta_hue{ 2.0 * std::sqrt( c1 * c2 ) * std::sin( delta_h / degrees / 2.0 ) };
+
+        const double l_bar{ ( lhs.l + rhs.l ) / 2.0 };
+        const double c_bar{ ( c1 + c2 ) / 2.0 };
+        double h_bar{ h1 + h2 };
+        if( c1 * c2 != 0.0 )
+        {
+            h_bar = std::abs( h1 - h2 ) <= 180.0 ? h_bar / 2.0 : h_bar < 360.0 ? ( h_bar + 360.0 ) / 2.0 : ( h_bar - 360.0 ) / 2.0;
+        }
+
+        const double t{ 1.0 - 0.17 * std::cos( ( h_bar - 30.0 ) / degrees ) + 0.24 * std::cos( 2.0 * h_bar / degrees ) +
+                        0.32 * std::cos( ( 3.0 * h_bar + 6.0 ) / degrees ) - 0.20 * std::cos( ( 4.0 * h_bar - 63.0 ) / degrees ) };
+        const double delta_theta{ 30.0 * std::exp( -( ( h_bar - 275.0 ) / 25.0 ) * ( ( h_bar - 275.0 ) / 25.0 ) ) };
+        const double c_bar7{ std::pow( c_bar, 7.0 ) };
+        const double r_c{ 2.0 * std::sqrt( c_bar7 / ( c_bar7 + pow25_7 ) ) };
+        const double s_l{ 1.0 + 0.015 * ( l_bar - 50.0 ) * ( l_bar - 50.0 ) / std::sqrt( 20.0 + ( l_bar - 50.0 ) * ( l_bar - 50.0 ) ) };
+        const double s_c{ 1.0 + 0.045 * c_bar };
+        const double s_h{ 1.0 + 0.015 * c_bar * t };
+        const double r_t{ -std::sin( 2.0 * delta_theta / degrees ) * r_c };
+
+        const double l_term{ delta_l / s_l };
+        const double c_term{ delta_c / s_c };
+        const double h_term{ delta_hue / s_h };
+        return std::sqrt( l_term * l_term + c_term * c_term + h_term * h_term + r_t * c_term * h_term );
+    }
+
+
+
+    namespace detail
+    {
+        struct delta_e_header
+        {
+            char     magic[4];
+            uint32_t version;
+            uint32_t metric;
+            uint32_t count;     //  Distinct values, i.e. rows.
+            uint32_t k;         //  Length of each nearest list.
+            float    scale;     //  Quantized value per unit of ΔE.
+            uint64_t table;     //  table_hash of the palette it was built from.
+        };
+        static_assert( sizeof( delta_e_header ) == 32 );
+
+        constexpr uint32_t delta_e_version{ 2 };
+
+        constexpr std::size_t triangle_size( std::size_t n )
+        {
+            return n * ( n - 1 ) / 2;
+        }
+
+        //   Position of the pair i < j in the row-major upper triangle, diagonal excluded.
+        constexpr std::size_t pair_index( std::size_t i, std::size_t j, std::size_t n )
+        {
+            return i * n - i * ( i + 1 ) / 2 + ( j - i - 1 );
+        }
+    }
+
+
+
+    class delta_e_matrix
+    {
+    public:
+        delta_e_matrix() = default;
+
+        delta_e_matrix( delta_e_matrix&& other ) noexcept
+        {
+            *this = static_cast<delta_e_matrix&&>( other );
+        }
+
+        delta_e_matrix& operator=( delta_e_matrix&& other ) noexcept
+        {
+            if( this != &other )
+            {
+                unmap();
+                header_ = other.header_;
+                data_ = other.data_;
+                owned_ = static_cast<std::vector<uint16_t>&&>( other.owned_ );
+                mapping_ = other.mapping_;
+                mapping_size_ = other.mapping_size_;
+                other.data_ = nullptr;
+                other.mapping_ = nullptr;
+                other.mapping_size_ = 0;
+            }
+            return *this;
+        }
+
+        delta_e_matrix( const delta_e_matrix& ) = delete;
+        delta_e_matrix& operator=( const delta_e_matrix& ) = delete;
+
+        ~delta_e_matrix()
+        {
+            unmap();
+        }
+
+        //   Computes the table.  k is capped at the number of distinct values less one.
+        static delta_e_matrix build( delta_e_metric metric = delta_e_metric::oklab, std::size_t k = 8 )
+        {
+            constexpr std::size_t n{ canonical_count };
+            k = std::min( k, n - 1 );
+
+            std::vector<double> distances( detail::triangle_size( n ) );
+            if( metric == delta_e_metric::oklab )
+            {
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    for( std::size_t j{ i + 1 }; j < n; ++j )
+                    {
+                        distances[detail::pair_index( i, j, n )] = std::sqrt( oklab_distance_squared( canonical_ids[i], canonical_ids[j] ) );
+                    }
+                }
+            }
+            else
+            {
+                std::vector<lab> colors( n );
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    colors[i] = to_lab( canonical_values[i] );
+                }
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    for( std::size_t j{ i + 1 }; j < n; ++j )
+                    {
+                        distances[detail::pair_index( i, j, n )] = ciede2000( colors[i], colors[j] );
+                    }
+                }
+            }
+            const double largest{ *std::max_element( distances.begin(), distances.end() ) };
+
+            delta_e_matrix matrix;
+            matrix.header_ = { { 'N', 'C', 'D', 'E' }, detail::delta_e_version, static_cast<uint32_t>( metric ),
+                               static_cast<uint32_t>( n ), static_cast<uint32_t>( k ), static_cast<float>( 65535.0 / largest ), table_hash };
+            matrix.owned_.resize( ( sizeof( detail::delta_e_header ) + file_size( n, k ) ) / 2 );
+            std::memcpy( matrix.owned_.data(), &matrix.header_, sizeof( matrix.header_ ) );
+            matrix.data_ = matrix.owned_.data() + sizeof( detail::delta_e_header ) / 2;
+
+            uint16_t* triangle{ matrix.owned_.data() + sizeof( detail::delta_e_header ) / 2 };
+            for( std::size_t i{ 0 }; i < distances.size(); ++i )
+            {
+                triangle[i] = static_cast<uint16_t>( std::min( 65535.0, distances[i] * matrix.header_.scale + 0.5 ) );
+            }
+
+            //   Nearest lists are ordered by the unquantized distance, ties by id.
+            uint16_t* nearest{ triangle + distances.size() };
+            std::vector<uint16_t> others( n - 1 );
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                const auto distance{ [&]( std::size_t j )
+                {
+                    return i < j ? distances[detail::pair_index( i, j, n )] : distances[detail::pair_index( j, i, n )];
+                } };
+                std::size_t count{ 0 };
+                for( std::size_t j{ 0 }; j < n; ++j )
+                {
+                    if( j != i )
+                    {
+                        others[count++] = static_cast<uint16_t>( j );
+                    }
+                }
+                std::partial_sort( others.begin(), others.begin() + static_cast<std::ptrdiff_t>( k ), others.end(), [&]( uint16_t lhs, uint16_t rhs )
+                {
+                    return distance( lhs ) < distance( rhs ) || ( distance( lhs ) == distance( rhs ) && lhs < rhs );
+                } );
+                for( std::size_t j{ 0 }; j < k; ++j )
+                {
+                    nearest[i * k + j] = canonical_ids[others[j]];
+                }
+            }
+            return matrix;
+        }
+
+        //   Maps a file written by save().  Returns an empty matrix if the file can't be read or wasn't generated from
+        // this version of the palette.
+        static delta_e_matrix open( const char* path )
+        {
+            delta_e_matrix matrix;
+#if defined(_WIN32)
+            HANDLE file{ CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) };
+            if( file == INVALID_HANDLE_VALUE )
+            {
+                return matrix;
+            }
+            LARGE_INTEGER size{};
+            HANDLE mapping{ GetFileSizeEx( file, &size ) ? CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) : nullptr };
+            CloseHandle( file );
+            if( !mapping )
+            {
+                return matrix;
+            }
+            void* view{ MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) };
+            CloseHandle( mapping );
+            if( !view )
+            {
+                return matrix;
+            }
+            matrix.mapping_ = view;
+            matrix.mapping_size_ = static_cast<std::size_t>( size.QuadPart );
+#else
+            const int fd{ ::open( path, O_RDONLY ) };
+            if( fd < 0 )
+            {
+                return matrix;
+            }
+            struct stat status{};
+            void* view{ ::fstat( fd, &status ) == 0 && status.st_size > 0
+                ? ::mmap( nullptr, static_cast<std::size_t>( status.st_size ), PROT_READ, MAP_SHARED, fd, 0 ) : MAP_FAILED };
+            ::close( fd );
+            if( view == MAP_FAILED )
+            {
+                return matrix;
+            }
+            matrix.mapping_ = view;
+            matrix.mapping_size_ = static_cast<std::size_t>( status.st_size );
+#endif
+            if( matrix.mapping_size_ < sizeof( detail::delta_e_header ) )
+            {
+                matrix.unmap();
+                return matrix;
+            }
+            std::memcpy( &matrix.header_, matrix.mapping_, sizeof( matrix.header_ ) );
+            const auto& header{ matrix.header_ };
+            if( std::memcmp( header.magic, "NCDE", 4 ) != 0 || header.version != detail::delta_e_version ||
+                header.count != canonical_count || header.table != table_hash || header.k >= header.count || !( header.scale > 0.0f ) ||
+                matrix.mapping_size_ != sizeof( detail::delta_e_header ) + file_size( header.count, header.k ) )
+            {
+                matrix.unmap();
+                return matrix;
+            }
+            matrix.data_ = static_cast<const uint16_t*>( matrix.mapping_ ) + sizeof( detail::delta_e_header ) / 2;
+            return matrix;
+        }
+
+        //   Writes the table in the format open() reads.
+        bool save( const char* path ) const
+        {
+            if( !data_ )
+            {
+                return false;
+            }
+            const auto* bytes{ reinterpret_cast<const char*>( data_ ) - sizeof( detail::delta_e_header ) };
+            const std::size_t size{ sizeof( detail::delta_e_header ) + file_size( header_.count, header_.k ) };
+#if defined(_WIN32)
+            HANDLE file{ CreateFileA( path, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr ) };
+            if( file == INVALID_HANDLE_VALUE )
+            {
+                return false;
+            }
+            DWORD written{ 0 };
+            const bool ok{ WriteFile( file, bytes, static_cast<DWORD>( size ), &written, nullptr ) && written == size };
+            CloseHandle( file );
+            return ok;
+#else
+            const int fd{ ::open( path, O_WRONLY | O_CREAT | O_TRUNC, 0644 ) };
+            if( fd < 0 )
+            {
+                return false;
+            }
+            std::size_t remaining{ size };
+            while( remaining > 0 )
+            {
+                const auto written{ ::write( fd, bytes, remaining ) };
+                if( written <= 0 )
+                {
+                    break;
+                }
+                bytes += written;
+                remaining -= static_cast<std::size_t>( written );
+            }
+            ::close( fd );
+            return remaining == 0;
+#endif
+        }
+
+        explicit operator bool() const     { return data_ != nullptr; }
+        delta_e_metric metric() const       { return static_cast<delta_e_metric>( header_.metric ); }
+        std::size_t k() const               { return header_.k; }
+
+        //   ΔE between two named colors, to within half a quantization step.  NaN if either id isn't a named color
+        // or the matrix is empty.
+        float distance( color_id lhs, color_id rhs ) const
+        {
+            if( !valid( lhs ) || !valid( rhs ) )
+            {
+                return std::numeric_limits<float>::quiet_NaN();
+            }
+            return static_cast<float>( quantized( lhs, rhs ) ) / header_.scale;
+        }
+
+        //   0 if either id isn't a named color or the matrix is empty.
+        uint16_t quantized( color_id lhs, color_id rhs ) const
+        {
+            if( !valid( lhs ) || !valid( rhs ) )
+            {
+                return 0;
+            }
+            std::size_t i{ canonical_index( lhs ) };
+            std::size_t j{ canonical_index( rhs ) };
+            if( i == j )
+            {
+                return 0;
+            }
+            if( i > j )
+            {
+                std::swap( i, j );
+            }
+            return data_[detail::pair_index( i, j, header_.count )];
+        }
+
+        //   The k named color values closest to id's, closest first.  Empty if id isn't a named color (such as
+        // no_color from a failed find()) or the matrix is empty.
+        id_span nearest( color_id id ) const
+        {
+            if( !valid( id ) )
+            {
+                return {};
+            }
+            const color_id* first{ data_ + detail::triangle_size( header_.count ) + canonical_index( id ) * header_.k };
+            return { first, first + header_.k };
+        }
+
+    private:
+        bool valid( color_id id ) const
+        {
+            return data_ != nullptr && id < color_count;
+        }
+
+        static std::size_t file_size( std::size_t n, std::size_t k )
+        {
+            return ( detail::triangle_size( n ) + n * k ) * sizeof( uint16_t );
+        }
+
+        void unmap()
+        {
+            if( mapping_ )
+            {
+#if defined(_WIN32)
+                UnmapViewOfFile( mapping_ );
+#else
+                ::munmap( mapping_, mapping_size_ );
+#endif
+            }
+            mapping_ = nullptr;
+            mapping_size_ = 0;
+            data_ = nullptr;
+            owned_.clear();
+        }
+
+        detail::delta_e_header header_{};
+        const uint16_t*        data_{ nullptr };     //  The triangle, followed by the nearest lists.
+        std::vector<uint16_t>  owned_;                //  Header and data when built rather than mapped.
+        void*                  mapping_{ nullptr };
+        std::size_t            mapping_size_{ 0 };
+    };
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Picks k named colors that are as far apart from each other as possible, for
+// categorical charts and the like.
+//
+//   This is the usual greedy max-min (farthest point) selection in OKLab: each new color is the candidate whose
+// distance to the closest already chosen color is largest.  Rather than recomputing those distances for every
+// pick, each candidate keeps its distance to the closest chosen color and only the newly chosen color is checked
+// against it, which is one pass over the candidates per pick.  The coordinates come from the precomputed
+// oklab_table and the candidates are gathered from the LCh range index, so a 40 color palette takes well under a
+// millisecond.  Nothing is allocated unless you ask for a std::vector back.
+//
+//   Candidates are canonical ids, so only the first of a group of aliases is ever picked.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_oklab.h"
+#include "named_colors_range_index.h"
+#include "named_colors_table.h"
+
+#include<array>
+#include<cstddef>
+#include<cstdint>
+#include<optional>
+#include<vector>
+
+
+
+namespace named_colors
+{
+    struct palette_constraints
+    {
+        lch_box                 region;     //  Only named colors inside this box are picked.
+        std::optional<uint32_t> seed;       //  If set, the first pick is the candidate closest to this color.
+    };
+
+    //   Writes up to k ids to out, in the order they were picked, and returns how many were written.  That is fewer
+    // than k only if fewer colors meet the constraints.
+    inline std::size_t distinct_palette( std::size_t k, const palette_constraints& constraints, color_id* out )
+    {
+        alignas( 32 ) std::array<float, canonical_count> l;
+        alignas( 32 ) std::array<float, canonical_count> a;
+        alignas( 32 ) std::array<float, canonical_count> b;
+        alignas( 32 ) std::array<float, canonical_count> closest;
+        std::array<color_id, canonical_count> ids;
+
+        std::size_t count{ 0 };
+        for_each_in_box( constraints.region, [&]( color_id id )
+        {
+            ids[count] = id;
+            l[count] = oklab_table.l[id];
+            a[count] = oklab_table.a[id];
+            b[count] = oklab_table.b[id];
+            ++count;
+        } );
+        if( k == 0 || count == 0 )
+        {
+            return 0;
+        }
+
+        //   Without a seed, start from the candidate farthest from the middle of all of them.
+        float target_l{ 0.0f };
+        float target_a{ 0.0f };
+        float target_b{ 0.0f };
+        if( constraints.seed )
+        {
+            const auto seed{ to_oklab( *constraints.seed ) };
+            target_l = static_cast<float>( seed.l );
+            target_a = static_cast<float>( seed.a );
+            target_b = static_cast<float>( seed.b );
+        }
+        else
+        {
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                target_l += l[i];
+                target_a += a[i];
+                target_b += b[i];
+            }
+            target_l /= static_cast<float>( count );
+            target_a /= static_cast<float>( count );
+            target_b /= static_cast<float>( count );
+        }
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            const float dl{ l[i] - target_l };
+            const float da{ a[i] - target_a };
+            const float db{ b[i] - target_b };
+            closest[i] = constraints.seed ? -( dl * dl + da * da + db * db ) : dl * dl + da * da + db * db;
+        }
+
+        //   closest[i] is the value to maximize; ties go to the lower id.  Picked candidates are set to -1 so they
+        // are never picked again.
+        std::size_t picked{ 0 };
+        for( ; picked < k && picked < count; ++picked )
+        {
+            std::size_t best{ 0 };
+            for( std::size_t i{ 1 }; i < count; ++i )
+            {
+                if( closest[i] > closest[best] || ( closest[i] == closest[best] && ids[i] < ids[best] ) )
+                {
+                    best = i;
+                }
+            }
+            out[picked] = ids[best];
+
+            const float pl{ l[best] };
+            const float pa{ a[best] };
+            const float pb{ b[best] };
+            if( picked == 0 )
+            {
+                for( std::size_t i{ 0 }; i < count; ++i )
+                {
+                    closest[i] = 1.0e30f;
+                }
+            }
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                const float dl{ l[i] - pl };
+                const float da{ a[i] - pa };
+                const float db{ b[i] - pb };
+                const float distance{ dl * dl + da * da + db * db };
+                closest[i] = distance < closest[i] ? distance : closest[i];
+            }
+            closest[best] = -1.0f;
+        }
+        return picked;
+    }
+
+    inline std::vector<color_id> distinct_palette( std::size_t k, const palette_constraints& constraints = {} )
+    {
+        std::vector<color_id> ids( k );
+        ids.resize( distinct_palette( k, constraints, ids.data() ) );
+        return ids;
+    }
+}
@@ -0,0 +1,330 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  The few named colors an image is mostly made of, with how much of it each
+// covers, for tagging images by color:
+//
+//      named_colors::dominant_color found[5];
+//      const auto count{ named_colors::dominant_colors( pixels.data(), pixels.size(), found ) };
+//      for( std::size_t i{ 0 }; i < count; ++i )
+//      {
+//          std::printf( "%s %.0f%%\n", named_colors::table[found[i].id].name.data(), found[i].coverage * 100.0f );
+//      }
+//
+//   A spread out subsample of the pixels is clustered in OKLab: median cut gives the starting clusters and a few
+// rounds of k-means refine them.  Each cluster's mean is then snapped to its nearest named color by OKLab distance;
+// clusters that snap to the same color are merged.  Only the subsample's size depends on the image, so a large image
+// costs little more than a thumbnail.  The sample planes are split so the k-means loops vectorize.
+//
+//   The batch version runs one image per task on a work_stealing_scheduler, for tagging many images at once.
+//
+//   The pixels are 0xRRGGBBAA, the same as hex_color values.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_oklab.h"
+#include "named_colors_scheduler.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+#include<numeric>
+#include<vector>
+
+
+
+namespace named_colors
+{
+    struct dominant_color
+    {
+        color_id id;
+        float    coverage;      //  Share of the sampled pixels, from 0 to 1.
+        uint32_t mean;          //  The cluster's mean color, before snapping to id.
+    };
+
+    struct dominant_options
+    {
+        std::size_t colors{ 5 };                //  At most this many results, and at most 16.
+        std::size_t samples{ 16384 };           //  Pixels looked at.  Images with fewer are used whole.
+        std::size_t iterations{ 6 };            //  k-means rounds after median cut, fewer if it settles.
+        bool        ignore_transparent{ true }; //  Leave out pixels with alpha below 128.
+    };
+
+    namespace detail
+    {
+        constexpr std::size_t max_dominant{ 16 };
+
+        //   The subsample in OKLab, one plane per coordinate.
+        struct dominant_samples
+        {
+            std::vector<float>        l;
+            std::vector<float>        a;
+            std::vector<float>        b;
+            std::vector<uint8_t>      label;
+            std::vector<uint8_t>      previous;
+            std::vector<float>        best;
+            std::vector<std::size_t>  order;
+        };
+
+        inline void add_sample( dominant_samples& s, uint32_t color )
+        {
+            const float r{ static_cast<float>( linear_table[red( color )] ) };
+            const float g{ static_cast<float>( linear_table[green( color )] ) };
+            const float b{ static_cast<float>( linear_table[blue( color )] ) };
+            const float l_{ std::cbrt( 0.4122214708f * r + 0.5363292134f * g + 0.0514459929f * b ) };
+            const float m_{ std::cbrt( 0.2119034982f * r + 0.6806995451f * g + 0.1073969566f * b ) };
+            const float s_{ std::cbrt( 0.0883024619f * r + 0.2817188376f * g + 0.6299787005f * b ) };
+            s.l.push_back( 0.2104542553f * l_ + 0.7936177850f * m_ - 0.0040720468f * s_ );
+            s.a.push_back( 1.9779984951f * l_ - 2.4285922050f * m_ + 0.4505937099f * s_ );
+            s.b.push_back( 0.0259040371f * l_ + 0.7827717662f * m_ - 0.8086757660f * s_ );
+        }
+
+        //   One pixel from each of samples equal stretches of the image, at a hashed offset within the stretch so
+        // the picks don't line up with the rows.
+        inline void subsample( const uint32_t* pixels, std::size_t count, const dominant_options& options, dominant_samples& s )
+        {
+            const std::size_t wanted{ std::min( count, std::max<std::size_t>( 1, options.samples ) ) };
+            s.l.clear();
+            s.a.clear();
+            s.b.clear();
+            for( std::size_t i{ 0 }; i < wanted; ++i )
+            {
+                const std::size_t first{ i * count / wanted };
+                const std::size_t width{ ( i + 1 ) * count / wanted - first };
+                const std::size_t offset{ width > 1 ? static_cast<std::size_t>( ( i * 0x9E'37'79'B9u ) >> 7 ) % width : 0 };
+                const uint32_t color{ pixels[first + offset] };
+                if( !options.ignore_transparent || alpha( color ) >= 0x80 )
+                {
+                    add_sample( s, color );
+                }
+            }
+        }
+
+        struct cluster
+        {
+            float l;
+            float a;
+            float b;
+        };
+
+        //   Splits the samples into up to k boxes, each time cutting the box with the most spread, weighted by how
+        // many samples it holds, at the median of its widest coordinate.  The boxes' means are the seeds.
+        inline std::size_t median_cut( dominant_samples& s, std::size_t k, cluster* seeds )
+        {
+            struct box
+            {
+                std::size_t first;
+                std::size_t last;
+            };
+
+            const std::size_t n{ s.l.size() };
+            s.order.resize( n );
+            std::iota( s.order.begin(), s.order.end(), std::size_t{ 0 } );
+            const float* planes[3]{ s.l.data(), s.a.data(), s.b.data() };
+
+            box boxes[max_dominant]{ { 0, n } };
+            std::size_t box_count{ 1 };
+            while( box_count < k )
+            {
+                std::size_t split{ box_count };
+                std::size_t axis{ 0 };
+                float best{ 0.0f };
+                for( std::size_t i{ 0 }; i < box_count; ++i )
+                {
+                    for( std::size_t c{ 0 }; c < 3; ++c )
+                    {
+                        float low{ 1.0e30f };
+                        float high{ -1.0e30f };
+                        for( std::size_t j{ boxes[i].first }; j < boxes[i].last; ++j )
+                        {
+                            low = std::min( low, planes[c][s.order[j]] );
+                            high = std::max( high, planes[c][s.order[j]] );
+                        }
+                        const float spread{ ( high - low ) * static_cast<float>( boxes[i].last - boxes[i].first ) };
+                        if( boxes[i].last - boxes[i].first > 1 && spread > best )
+                        {
+                            split = i;
+                            axis = c;
+                            best = spread;
+                        }
+                    }
+                }
+                if( split == box_count )
+                {
+                    break;
+                }
+
+                const auto first{ s.order.begin() + static_cast<std::ptrdiff_t>( boxes[split].first ) };
+                const auto last{ s.order.begin() + static_cast<std::ptrdiff_t>( boxes[split].last ) };
+                const auto middle{ first + ( last - first ) / 2 };
+                const float* plane{ planes[axis] };
+                std::nth_element( first, middle, last, [plane]( std::size_t lhs, std::size_t rhs ) { return plane[lhs] < plane[rhs]; } );
+                const auto cut{ static_cast<std::size_t>( middle - s.order.begin() ) };
+                boxes[box_count++] = { cut, boxes[split].last };
+                boxes[split].last = cut;
+            }
+
+            for( std::size_t i{ 0 }; i < box_count; ++i )
+            {
+                double sum[3]{};
+                for( std::size_t j{ boxes[i].first }; j < boxes[i].last; ++j )
+                {
+                    sum[0] += s.l[s.order[j]];
+                    sum[1] += s.a[s.order[j]];
+                    sum[2] += s.b[s.order[j]];
+                }
+                const double size{ static_cast<double>( boxes[i].last - boxes[i].first ) };
+                seeds[i] = { static_cast<float>( sum[0] / size ), static_cast<float>( sum[1] / size ), static_cast<float>( sum[2] / size ) };
+            }
+            return box_count;
+        }
+
+        //   Labels every sample with its nearest cluster and returns how many labels changed.
+        inline std::size_t assign( dominant_samples& s, const cluster* clusters, std::size_t k )
+        {
+            s.previous.swap( s.label );
+            const std::size_t n{ s.l.size() };
+            const float* l{ s.l.data() };
+            const float* a{ s.a.data() };
+            const float* b{ s.b.data() };
+            float* best{ s.best.data() };
+            uint8_t* label{ s.label.data() };
+            std::fill( s.best.begin(), s.best.end(), 1.0e30f );
+
+            //   A cluster at a time over all samples, so the inner loop is branch free and vectorizes.
+            for( std::size_t c{ 0 }; c < k; ++c )
+            {
+                const cluster centre{ clusters[c] };
+                const auto id{ static_cast<uint8_t>( c ) };
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    const float dl{ l[i] - centre.l };
+                    const float da{ a[i] - centre.a };
+                    const float db{ b[i] - centre.b };
+                    const float distance{ dl * dl + da * da + db * db };
+                    const bool closer{ distance < best[i] };
+                    best[i] = closer ? distance : best[i];
+                    label[i] = closer ? id : label[i];
+                }
+            }
+
+            std::size_t changed{ 0 };
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                changed += label[i] != s.previous[i];
+            }
+            return changed;
+        }
+
+        inline void update( const dominant_samples& s, cluster* clusters, std::size_t k, std::size_t* sizes )
+        {
+            double sum[max_dominant][3]{};
+            std::fill( sizes, sizes + k, std::size_t{ 0 } );
+            for( std::size_t i{ 0 }; i < s.l.size(); ++i )
+            {
+                const std::size_t c{ s.label[i] };
+                sum[c][0] += s.l[i];
+                sum[c][1] += s.a[i];
+                sum[c][2] += s.b[i];
+                ++sizes[c];
+            }
+
+            //   A cluster that lost all its samples stays where it was.
+            for( std::size_t c{ 0 }; c < k; ++c )
+            {
+                if( sizes[c] > 0 )
+                {
+                    const double size{ static_cast<double>( sizes[c] ) };
+                    clusters[c] = { static_cast<float>( sum[c][0] / size ), static_cast<float>( sum[c][1] / size ),
+                                    static_cast<float>( sum[c][2] / size ) };
+                }
+            }
+        }
+
+        inline std::size_t dominant_colors( const uint32_t* pixels, std::size_t count, dominant_color* out,
+                                            const dominant_options& options, dominant_samples& s )
+        {
+            subsample( pixels, count, options, s );
+            const std::size_t n{ s.l.size() };
+            const std::size_t wanted{ std::min( options.colors, max_dominant ) };
+            if( n == 0 || wanted == 0 )
+            {
+                return 0;
+            }
+            s.label.assign( n, 0 );
+            s.previous.assign( n, 0 );
+            s.best.resize( n );
+
+            cluster clusters[max_dominant];
+            const std::size_t k{ median_cut( s, wanted, clusters ) };
+
+            std::size_t sizes[max_dominant]{};
+            assign( s, clusters, k );
+            for( std::size_t round{ 0 }; round < options.iterations; ++round )
+            {
+                update( s, clusters, k, sizes );
+                if( assign( s, clusters, k ) == 0 )
+                {
+                    break;
+                }
+            }
+            update( s, clusters, k, sizes );
+
+            //   Snap to names, merging clusters that snap to the same one, most coverage first.
+            std::size_t found{ 0 };
+            for( std::size_t c{ 0 }; c < k; ++c )
+            {
+                if( sizes[c] == 0 )
+                {
+                    continue;
+                }
+                const oklab mean{ clusters[c].l, clusters[c].a, clusters[c].b };
+                const color_id id{ nearest_oklab( mean ) };
+                const float coverage{ static_cast<float>( sizes[c] ) / static_cast<float>( n ) };
+                auto* same{ std::find_if( out, out + found, [id]( const dominant_color& d ) { return d.id == id; } ) };
+                if( same != out + found )
+                {
+                    same->coverage += coverage;
+                    continue;
+                }
+                out[found++] = { id, coverage, to_hex( to_linear( mean ) ) };
+            }
+            std::sort( out, out + found, []( const dominant_color& lhs, const dominant_color& rhs )
+            {
+                return lhs.coverage > rhs.coverage || ( lhs.coverage == rhs.coverage && lhs.id < rhs.id );
+            } );
+            return found;
+        }
+    }
+
+    //   Writes up to options.colors dominant colors of the pixels to out, most coverage first, and returns how many.
+    // Fewer are found when the pixels have fewer distinct colors or several clusters snap to the same name.  None
+    // are found if every pixel is transparent.
+    inline std::size_t dominant_colors( const uint32_t* pixels, std::size_t count, dominant_color* out,
+                                        const dominant_options& options = {} )
+    {
+        detail::dominant_samples samples;
+        return detail::dominant_colors( pixels, count, out, options, samples );
+    }
+
+    //   The same for every image: writes found[i] dominant colors of images[i] to out[i], which has room for
+    // options.colors.
+    inline void dominant_colors( work_stealing_scheduler& scheduler, const image_span* images, std::size_t count,
+                                 dominant_color* const* out, std::size_t* found, const dominant_options& options = {} )
+    {
+        //   The images are handed to the scheduler as one pixel long spans, so each is a single task however large.
+        std::vector<image_span> tasks( count, image_span{ nullptr, 1 } );
+        std::vector<detail::dominant_samples> scratch( scheduler.size() );
+        scheduler.run( tasks.data(), count, [&]( std::size_t image, std::size_t, std::size_t, std::size_t thread )
+        {
+            found[image] = detail::dominant_colors( images[image].colors, images[image].count, out[image], options, scratch[thread] );
+        } );
+    }
+}
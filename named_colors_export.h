@@ -0,0 +1,295 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Writes out the whole palette as a text table, CSV, JSON or a list of hex values.
+//
+//   Everything is formatted with std::to_chars into a single buffer that is sized up front, so exporting the
+// palette is one allocation (or none, if you provide the buffer) and one write to the output file.
+//
+//   The text format is the same as what test_app.cpp prints with NAMED_COLORS_ENABLE_TUPLES defined.
+//
+//   Requires C++17 and a standard library with floating point std::to_chars.
+//
+
+
+
+#include "named_colors_table.h"
+
+#include<array>
+#include<charconv>
+#include<cstddef>
+#include<cstdint>
+#include<cstdio>
+#include<cstring>
+#include<string>
+
+#if defined(_WIN32)
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include<windows.h>
+#else
+#   include<fcntl.h>
+#   include<unistd.h>
+#endif
+
+
+
+namespace named_colors
+{
+    enum class export_format
+    {
+        text,   //  NAME                                    :   R:0.745098  G:...   (as printed by test_app.cpp)
+        csv,    //  name,hex,red,green,blue,alpha
+        json,   //  [ { "name": "...", "hex": "#RRGGBB", "rgba": [ r, g, b, a ] }, ... ]
+        hex     //  #RRGGBB NAME
+    };
+
+
+
+    namespace detail
+    {
+        //   Longest line any format writes for a color, not counting the name itself.  Normalized channels are
+        // printed with at most 6 significant digits, so "0.745098" is the longest a channel can be.
+        constexpr std::size_t export_line_overhead( export_format format )
+        {
+            switch( format )
+            {
+            case export_format::text: return 40 + 3 + 4 * ( 3 + 10 ) + 1;
+            case export_format::csv:  return 1 + 7 + 4 * 4 + 1;
+            case export_format::json: return 64 + 7 + 4 * 4;
+            case export_format::hex:  return 7 + 1 + 1;
+            }
+            return 0;
+        }
+
+        constexpr std::size_t total_name_size()
+        {
+            std::size_t size{ 0 };
+            for( const auto& e : table )
+            {
+                size += e.name.size();
+            }
+            return size;
+        }
+
+        constexpr char hex_digits[]{ "0123456789ABCDEF" };
+
+        inline char* put( char* out, std::string_view text )
+        {
+            std::memcpy( out, text.data(), text.size() );
+            return out + text.size();
+        }
+
+        inline char* put_padded( char* out, std::string_view text, std::size_t width )
+        {
+            out = put( out, text );
+
+            //   Pad by code points rather than bytes so names like CAFÉ_AU_LAIT line up with the rest.
+            std::size_t length{ 0 };
+            for( const char c : text )
+            {
+                length += ( static_cast<uint8_t>( c ) & 0xC0 ) != 0x80;
+            }
+            for( ; length < width; ++length )
+            {
+                *out++ = ' ';
+            }
+            return out;
+        }
+
+        inline char* put_hex( char* out, uint32_t color )
+        {
+            *out++ = '#';
+            for( int shift{ 28 }; shift >= 8; shift -= 4 )
+            {
+                *out++ = hex_digits[( color >> shift ) & 0xF];
+            }
+            return out;
+        }
+
+        inline char* put_uint( char* out, char* last, unsigned value )
+        {
+            return std::to_chars( out, last, value ).ptr;
+        }
+
+        //   Same digits as std::ostream's default formatting of a double (%g with a precision of 6), left justified
+        // in a field of 10 like test_app.cpp's std::setw( 10 ).  There are only 256 possible channel values so they
+        // are each formatted once and copied from then on.
+        inline const std::array<std::array<char, 10>, 256>& normalized_channels()
+        {
+            static const auto channels{ []
+            {
+                std::array<std::array<char, 10>, 256> formatted{};
+                for( std::size_t i{ 0 }; i < formatted.size(); ++i )
+                {
+                    auto& text{ formatted[i] };
+                    text.fill( ' ' );
+                    std::to_chars( text.data(), text.data() + text.size(),
+                                   static_cast<double>( static_cast<float>( i ) / 255.0f ), std::chars_format::general, 6 );
+                }
+                return formatted;
+            }() };
+            return channels;
+        }
+
+        inline char* export_entry( export_format format, const entry& e, bool last_entry, char* out, char* last )
+        {
+            const uint8_t channels[4]{ red( e.value ), green( e.value ), blue( e.value ), alpha( e.value ) };
+            switch( format )
+            {
+            case export_format::text:
+            {
+                static constexpr std::string_view labels[4]{ "R:", "\tG:", "\tB:", "\tA:" };
+                const auto& normalized{ normalized_channels() };
+                out = put_padded( out, e.name, 40 );
+                out = put( out, ":\t" );
+                for( int i{ 0 }; i < 4; ++i )
+                {
+                    out = put( out, labels[i] );
+                    std::memcpy( out, normalized[channels[i]].data(), 10 );
+                    out += 10;
+                }
+                *out++ = '\n';
+                return out;
+            }
+            case export_format::csv:
+                out = put( out, e.name );
+                *out++ = ',';
+                out = put_hex( out, e.value );
+                for( const auto channel : channels )
+                {
+                    *out++ = ',';
+                    out = put_uint( out, last, channel );
+                }
+                *out++ = '\n';
+                return out;
+            case export_format::json:
+                out = put( out, "  { \"name\": \"" );
+                out = put( out, e.name );
+                out = put( out, "\", \"hex\": \"" );
+                out = put_hex( out, e.value );
+                out = put( out, "\", \"rgba\": [ " );
+                for( int i{ 0 }; i < 4; ++i )
+                {
+                    out = put_uint( out, last, channels[i] );
+                    out = put( out, i < 3 ? ", " : " ] }" );
+                }
+                out = put( out, last_entry ? "\n" : ",\n" );
+                return out;
+            case export_format::hex:
+                out = put_hex( out, e.value );
+                *out++ = ' ';
+                out = put( out, e.name );
+                *out++ = '\n';
+                return out;
+            }
+            return out;
+        }
+    }
+
+
+
+    //   Enough bytes to hold the whole palette in the given format.
+    constexpr std::size_t export_size( export_format format )
+    {
+        constexpr std::size_t names{ detail::total_name_size() };
+        return 32 + names + table.size() * detail::export_line_overhead( format );
+    }
+
+    //   Formats the palette into [first, last) and returns one past the last character written, or nullptr if the
+    // buffer is smaller than export_size( format ).
+    inline char* export_palette( export_format format, char* first, char* last )
+    {
+        if( static_cast<std::size_t>( last - first ) < export_size( format ) )
+        {
+            return nullptr;
+        }
+
+        char* out{ first };
+        if( format == export_format::csv )
+        {
+            out = detail::put( out, "name,hex,red,green,blue,alpha\n" );
+        }
+        else if( format == export_format::json )
+        {
+            out = detail::put( out, "[\n" );
+        }
+
+        for( std::size_t id{ 0 }; id < table.size(); ++id )
+        {
+            out = detail::export_entry( format, table[id], id + 1 == table.size(), out, last );
+        }
+
+        if( format == export_format::json )
+        {
+            out = detail::put( out, "]\n" );
+        }
+        return out;
+    }
+
+    inline std::string export_palette( export_format format )
+    {
+        std::string text( export_size( format ), '\0' );
+        char* const end{ export_palette( format, text.data(), text.data() + text.size() ) };
+        text.resize( static_cast<std::size_t>( end - text.data() ) );
+        return text;
+    }
+
+    namespace detail
+    {
+        //   Writes size bytes to path, or stdout if path is null, with a single write call barring partial writes.
+        inline bool write_file( const char* path, const char* data, std::size_t size )
+        {
+#if defined(_WIN32)
+            HANDLE file{ path ? CreateFileA( path, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr )
+                              : GetStdHandle( STD_OUTPUT_HANDLE ) };
+            if( file == INVALID_HANDLE_VALUE )
+            {
+                return false;
+            }
+            DWORD written{ 0 };
+            const bool ok{ WriteFile( file, data, static_cast<DWORD>( size ), &written, nullptr ) && written == size };
+            if( path )
+            {
+                CloseHandle( file );
+            }
+            return ok;
+#else
+            const int fd{ path ? ::open( path, O_WRONLY | O_CREAT | O_TRUNC, 0644 ) : STDOUT_FILENO };
+            if( fd < 0 )
+            {
+                return false;
+            }
+            std::size_t remaining{ size };
+            while( remaining > 0 )
+            {
+                const auto written{ ::write( fd, data, remaining ) };
+                if( written <= 0 )
+                {
+                    break;
+                }
+                data += written;
+                remaining -= static_cast<std::size_t>( written );
+            }
+            if( path )
+            {
+                ::close( fd );
+            }
+            return remaining == 0;
+#endif
+        }
+    }
+
+    //   Writes the palette to path (or stdout if path is null) with a single write call, barring partial writes.
+    // Returns false if the file couldn't be opened or written.
+    inline bool write_palette( export_format format, const char* path = nullptr )
+    {
+        const auto text{ export_palette( format ) };
+        return detail::write_file( path, text.data(), text.size() );
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  The whole palette as an array of float4 (normalized R, G, B, A) laid out the way
+// a vec4 array is laid out in a std140 or std430 uniform/storage block (and an HLSL float4 array in a constant
+// buffer), computed at compile time.  Uploading it is a single copy of static data:
+//
+//      std::memcpy( mapped, named_colors::gpu_palette.data(), sizeof( named_colors::gpu_palette ) );
+//
+//   and a shader then reads palette[ named_colors::gpu_index( hex_color::NAVY_BLUE ) ].  gpu_palette_linear holds
+// the same colors with the sRGB transfer function removed, for shaders that blend in linear space.
+//
+//   Entry i is table[i], so every name has its own entry.  Aliases have identical entries and gpu_index() maps a
+// value to the first of them, since an enum or constant can't tell aliases apart.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_table.h"
+
+#include<array>
+#include<cstddef>
+#include<cstdint>
+
+
+
+namespace named_colors
+{
+    //   Matches a GLSL vec4 / HLSL float4: 16 bytes, 16 byte aligned, so an array of them has the 16 byte stride
+    // both std140 and std430 require.
+    struct alignas( 16 ) float4
+    {
+        float r;
+        float g;
+        float b;
+        float a;
+    };
+    static_assert( sizeof( float4 ) == 16 && alignof( float4 ) == 16 );
+
+    namespace detail
+    {
+        constexpr std::array<float4, color_count> make_gpu_palette( bool linear )
+        {
+            std::array<float4, color_count> colors{};
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                const auto value{ table[id].value };
+                colors[id] = linear
+                    ? float4{ static_cast<float>( linear_table[red( value )] ),
+                              static_cast<float>( linear_table[green( value )] ),
+                              static_cast<float>( linear_table[blue( value )] ),
+                              static_cast<float>( alpha( value ) ) / 255.0f }
+                    : float4{ static_cast<float>( red( value ) ) / 255.0f,
+                              static_cast<float>( green( value ) ) / 255.0f,
+                              static_cast<float>( blue( value ) ) / 255.0f,
+                              static_cast<float>( alpha( value ) ) / 255.0f };
+            }
+            return colors;
+        }
+    }
+
+    //   Normalized sRGB, the same values as from_hex().  Indexed by color_id.
+    inline constexpr std::array<float4, color_count> gpu_palette{ detail::make_gpu_palette( false ) };
+
+    //   Linear RGB, alpha unchanged.  Indexed by color_id.
+    inline constexpr std::array<float4, color_count> gpu_palette_linear{ detail::make_gpu_palette( true ) };
+
+    static_assert( sizeof( gpu_palette ) == color_count * 16, "the palette must have no padding beyond std140/std430" );
+
+    //   Index of a color in gpu_palette, as a shader would use it.
+#if defined(NAMED_COLORS_PREFER_ENUM)
+    constexpr uint32_t gpu_index( hex_color color )
+#else
+    constexpr uint32_t gpu_index( uint32_t color )
+#endif
+    {
+        return id_of( static_cast<uint32_t>( color ) );
+    }
+}
@@ -0,0 +1,329 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Gradients and colormap lookup tables between named colors, interpolated in OKLab
+// (or linear RGB) rather than directly between sRGB values, which avoids the dull, dark middles of sRGB gradients.
+//
+//   There are two ways to build one:
+//
+//      constexpr auto ramp{ named_colors::make_gradient<256>( hex_color::NAVY_BLUE, hex_color::GOLD ) };
+//
+//   computes the table at compile time, so fixed ramps cost nothing at run time.  For gradients only known at run
+// time, named_colors::gradient samples in blocks: the stops are interpolated into plain float arrays first and
+// then converted to RGB in straight loops with no branches, which compilers vectorize.  Packed output goes through
+// a 64K entry table for the sRGB transfer function.
+//
+//   Results of the two can differ by one step in a channel since the run time version works in float.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<array>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+#include<initializer_list>
+#include<vector>
+
+
+
+namespace named_colors
+{
+    enum class interpolation
+    {
+        oklab,
+        linear_rgb
+    };
+
+    //   What the channels of a float lookup table hold.
+    enum class lut_encoding
+    {
+        srgb,
+        linear
+    };
+
+    //   position goes from 0 to 1 and must not decrease from one stop to the next.
+    struct gradient_stop
+    {
+        uint32_t color;
+        double   position;
+    };
+
+
+
+    namespace detail
+    {
+        //   A stop converted into the space it is interpolated in.
+        struct gradient_point
+        {
+            double c0;
+            double c1;
+            double c2;
+            double alpha;
+            double position;
+        };
+
+        constexpr gradient_point to_point( const gradient_stop& stop, interpolation space )
+        {
+            const double alpha{ static_cast<double>( stop.color & 0xFF ) / 255.0 };
+            if( space == interpolation::oklab )
+            {
+                const auto c{ to_oklab( stop.color ) };
+                return { c.l, c.a, c.b, alpha, stop.position };
+            }
+            const auto c{ to_linear( stop.color ) };
+            return { c.r, c.g, c.b, alpha, stop.position };
+        }
+
+        template<std::size_t S>
+        constexpr uint32_t gradient_at( const std::array<gradient_point, S>& points, double t, interpolation space )
+        {
+            std::size_t segment{ 0 };
+            while( segment + 2 < S && t > points[segment + 1].position )
+            {
+                ++segment;
+            }
+            const auto& from{ points[segment] };
+            const auto& to{ points[S > 1 ? segment + 1 : segment] };
+            const double width{ to.position - from.position };
+            double u{ width > 0.0 ? ( t - from.position ) / width : 0.0 };
+            u = u < 0.0 ? 0.0 : u > 1.0 ? 1.0 : u;
+
+            const double c0{ from.c0 + ( to.c0 - from.c0 ) * u };
+            const double c1{ from.c1 + ( to.c1 - from.c1 ) * u };
+            const double c2{ from.c2 + ( to.c2 - from.c2 ) * u };
+            const auto alpha{ static_cast<uint8_t>( ( from.alpha + ( to.alpha - from.alpha ) * u ) * 255.0 + 0.5 ) };
+            return to_hex( space == interpolation::oklab ? to_linear( oklab{ c0, c1, c2 } ) : linear_rgb{ c0, c1, c2 }, alpha );
+        }
+    }
+
+
+
+    //   N colors sampled evenly from the first stop to the last.
+    template<std::size_t N, std::size_t S>
+    constexpr std::array<uint32_t, N> make_gradient( const std::array<gradient_stop, S>& stops, interpolation space = interpolation::oklab )
+    {
+        static_assert( S > 0, "a gradient needs at least one stop" );
+        std::array<detail::gradient_point, S> points{};
+        for( std::size_t i{ 0 }; i < S; ++i )
+        {
+            points[i] = detail::to_point( stops[i], space );
+        }
+
+        std::array<uint32_t, N> lut{};
+        for( std::size_t i{ 0 }; i < N; ++i )
+        {
+            const double t{ N > 1 ? static_cast<double>( i ) / static_cast<double>( N - 1 ) : 0.0 };
+            lut[i] = detail::gradient_at( points, t, space );
+        }
+        return lut;
+    }
+
+    //   N colors through evenly spaced stops, e.g. make_gradient<256>( hex_color::NAVY_BLUE, hex_color::GOLD ).
+    template<std::size_t N, interpolation Space = interpolation::oklab, typename... Colors>
+    constexpr std::array<uint32_t, N> make_gradient( Colors... colors )
+    {
+        constexpr std::size_t count{ sizeof...( Colors ) };
+        static_assert( count > 0, "a gradient needs at least one stop" );
+
+        //   Filled from the pack directly; an array of the colors would be zero sized, and fail first, without any.
+        std::array<gradient_stop, count> stops{};
+        std::size_t i{ 0 };
+        ( ( stops[i] = { static_cast<uint32_t>( colors ), count > 1 ? static_cast<double>( i ) / static_cast<double>( count - 1 ) : 0.0 }, ++i ), ... );
+        return make_gradient<N>( stops, Space );
+    }
+
+
+
+    class gradient
+    {
+    public:
+        //   Evenly spaced stops.
+        gradient( std::initializer_list<uint32_t> colors, interpolation space = interpolation::oklab ) : space_( space )
+        {
+            std::size_t i{ 0 };
+            for( const auto color : colors )
+            {
+                add( { color, colors.size() > 1 ? static_cast<double>( i++ ) / static_cast<double>( colors.size() - 1 ) : 0.0 } );
+            }
+        }
+
+        gradient( const gradient_stop* stops, std::size_t count, interpolation space = interpolation::oklab ) : space_( space )
+        {
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                add( stops[i] );
+            }
+        }
+
+        //   count colors sampled evenly from the first stop to the last, as 0xRRGGBBAA.
+        void sample( uint32_t* out, std::size_t count ) const
+        {
+            const auto& encode{ encode_table() };
+            run( count, [out, &encode]( std::size_t first, std::size_t n, const float* r, const float* g, const float* b, const float* a )
+            {
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    out[first + i] = ( static_cast<uint32_t>( encode[quantize( r[i] )] ) << 24 ) |
+                                     ( static_cast<uint32_t>( encode[quantize( g[i] )] ) << 16 ) |
+                                     ( static_cast<uint32_t>( encode[quantize( b[i] )] ) << 8 ) |
+                                     static_cast<uint32_t>( a[i] * 255.0f + 0.5f );
+                }
+            } );
+        }
+
+        //   count * 4 floats in R, G, B, A order.
+        void sample( float* rgba, std::size_t count, lut_encoding encoding = lut_encoding::srgb ) const
+        {
+            run( count, [rgba, encoding]( std::size_t first, std::size_t n, const float* r, const float* g, const float* b, const float* a )
+            {
+                float* out{ rgba + first * 4 };
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    out[i * 4 + 0] = clamp( r[i] );
+                    out[i * 4 + 1] = clamp( g[i] );
+                    out[i * 4 + 2] = clamp( b[i] );
+                    out[i * 4 + 3] = a[i];
+                }
+                if( encoding == lut_encoding::srgb )
+                {
+                    for( std::size_t i{ 0 }; i < n * 4; ++i )
+                    {
+                        if( i % 4 != 3 )
+                        {
+                            out[i] = out[i] <= 0.0031308f ? out[i] * 12.92f : 1.055f * std::pow( out[i], 1.0f / 2.4f ) - 0.055f;
+                        }
+                    }
+                }
+            } );
+        }
+
+        std::vector<uint32_t> lut( std::size_t count ) const
+        {
+            std::vector<uint32_t> colors( count );
+            sample( colors.data(), count );
+            return colors;
+        }
+
+    private:
+        struct point
+        {
+            float c0;
+            float c1;
+            float c2;
+            float alpha;
+            float position;
+        };
+
+        void add( const gradient_stop& stop )
+        {
+            const auto p{ detail::to_point( stop, space_ ) };
+            points_.push_back( { static_cast<float>( p.c0 ), static_cast<float>( p.c1 ), static_cast<float>( p.c2 ),
+                                 static_cast<float>( p.alpha ), static_cast<float>( p.position ) } );
+        }
+
+        static float clamp( float value )
+        {
+            return value < 0.0f ? 0.0f : value > 1.0f ? 1.0f : value;
+        }
+
+        static std::size_t quantize( float linear )
+        {
+            return static_cast<std::size_t>( clamp( linear ) * 65535.0f + 0.5f );
+        }
+
+        //   8 bit sRGB value of every 16 bit linear value.
+        static const std::array<uint8_t, 65536>& encode_table()
+        {
+            static const auto encode{ []
+            {
+                std::array<uint8_t, 65536> values{};
+                for( std::size_t i{ 0 }; i < values.size(); ++i )
+                {
+                    const double linear{ static_cast<double>( i ) / 65535.0 };
+                    const double encoded{ linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow( linear, 1.0 / 2.4 ) - 0.055 };
+                    values[i] = static_cast<uint8_t>( encoded * 255.0 + 0.5 );
+                }
+                return values;
+            }() };
+            return encode;
+        }
+
+        //   Calls store( first, n, r, g, b, a ) with linear RGB for blocks of samples.
+        template<typename Store>
+        void run( std::size_t count, Store store ) const
+        {
+            if( points_.empty() || count == 0 )
+            {
+                return;
+            }
+
+            constexpr std::size_t block{ 256 };
+            alignas( 32 ) float c0[block];
+            alignas( 32 ) float c1[block];
+            alignas( 32 ) float c2[block];
+            alignas( 32 ) float a[block];
+            alignas( 32 ) float r[block];
+            alignas( 32 ) float g[block];
+            alignas( 32 ) float b[block];
+
+            const float step{ count > 1 ? 1.0f / static_cast<float>( count - 1 ) : 0.0f };
+            std::size_t segment{ 0 };
+
+            for( std::size_t first{ 0 }; first < count; first += block )
+            {
+                const std::size_t n{ std::min( block, count - first ) };
+
+                //   Interpolate the stops.  Samples only move forward so the current segment does too.
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    const float t{ i + first + 1 == count ? 1.0f : static_cast<float>( first + i ) * step };
+                    while( segment + 2 < points_.size() && t > points_[segment + 1].position )
+                    {
+                        ++segment;
+                    }
+                    const auto& from{ points_[segment] };
+                    const auto& to{ points_[points_.size() > 1 ? segment + 1 : segment] };
+                    const float width{ to.position - from.position };
+                    const float u{ width > 0.0f ? clamp( ( t - from.position ) / width ) : 0.0f };
+                    c0[i] = from.c0 + ( to.c0 - from.c0 ) * u;
+                    c1[i] = from.c1 + ( to.c1 - from.c1 ) * u;
+                    c2[i] = from.c2 + ( to.c2 - from.c2 ) * u;
+                    a[i] = from.alpha + ( to.alpha - from.alpha ) * u;
+                }
+
+                //   Convert to linear RGB.  No branches or calls, so this is the part that gets vectorized.
+                if( space_ == interpolation::oklab )
+                {
+                    for( std::size_t i{ 0 }; i < n; ++i )
+                    {
+                        const float l_{ c0[i] + 0.3963377774f * c1[i] + 0.2158037573f * c2[i] };
+                        const float m_{ c0[i] - 0.1055613458f * c1[i] - 0.0638541728f * c2[i] };
+                        const float s_{ c0[i] - 0.0894841775f * c1[i] - 1.2914855480f * c2[i] };
+                        const float l{ l_ * l_ * l_ };
+                        const float m{ m_ * m_ * m_ };
+                        const float s{ s_ * s_ * s_ };
+                        r[i] = 4.0767416621f * l - 3.3077115913f * m + 0.2309699292f * s;
+                        g[i] = -1.2684380046f * l + 2.6097574011f * m - 0.3413193965f * s;
+                        b[i] = -0.0041960863f * l - 0.7034186147f * m + 1.7076147010f * s;
+                    }
+                    store( first, n, r, g, b, a );
+                }
+                else
+                {
+                    store( first, n, c0, c1, c2, a );
+                }
+            }
+        }
+
+        interpolation      space_;
+        std::vector<point> points_;
+    };
+}
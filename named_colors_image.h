@@ -0,0 +1,548 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Just enough image I/O to run the named palette over pictures in tests and batch
+// jobs without an imaging library: binary PPM (P6) and PAM (P7) with 8 bit channels, and headerless RGBA8.
+//
+//   Files are memory mapped both ways.  mapped_image hands out the pixels where they sit in the file, and the
+// bulk searches take those interleaved bytes as they are, so nothing is copied or converted on the way in.
+// image_output maps the file being written, so the searches write their results straight into it:
+//
+//      auto image{ named_colors::mapped_image::open( "photo.ppm" ) };
+//      auto index{ named_colors::image_output::create_index( "photo_ids.pam", image.width(), image.height() ) };
+//      named_colors::nearest( image.pixels(), image.pixel_count(), image.channels(), index.ids() );
+//      index.close();
+//
+//   or all at once, with a legend of the colors found, name_image( image, "photo_ids.pam", "photo_legend.csv" ).
+// palette::quantize() and palette::recolor() take the same pixels for fixed palettes.
+//
+//   An index image is a PAM of one 16 bit sample per pixel holding the color_id (an index of named_colors::table)
+// of the pixel's nearest named color.  PAM stores samples big endian; close() puts the ids in that order, so
+// ids() is only valid before it.  The legend is CSV of id,name,hex,pixels for each color that occurs.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_export.h"
+#include "named_colors_table.h"
+
+#include<charconv>
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
+#include<string>
+#include<string_view>
+#include<vector>
+
+#if defined(_WIN32)
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include<windows.h>
+#else
+#   include<fcntl.h>
+#   include<sys/mman.h>
+#   include<sys/stat.h>
+#   include<unistd.h>
+#endif
+
+
+
+namespace named_colors
+{
+    enum class image_format
+    {
+        ppm,        //  P6, RGB.
+        pam,        //  P7, RGB_ALPHA.
+        raw_rgba    //  No header, R, G, B, A bytes.
+    };
+
+    namespace detail
+    {
+        //   A whole file mapped into memory, read only or, for new files, read write.
+        class file_mapping
+        {
+        public:
+            file_mapping() = default;
+
+            file_mapping( file_mapping&& other ) noexcept : data_( other.data_ ), size_( other.size_ )
+            {
+                other.data_ = nullptr;
+                other.size_ = 0;
+            }
+
+            file_mapping& operator=( file_mapping&& other ) noexcept
+            {
+                if( this != &other )
+                {
+                    unmap();
+                    data_ = other.data_;
+                    size_ = other.size_;
+                    other.data_ = nullptr;
+                    other.size_ = 0;
+                }
+                return *this;
+            }
+
+            file_mapping( const file_mapping& ) = delete;
+            file_mapping& operator=( const file_mapping& ) = delete;
+
+            ~file_mapping()
+            {
+                unmap();
+            }
+
+            static file_mapping open( const char* path )
+            {
+                file_mapping mapping;
+#if defined(_WIN32)
+                HANDLE file{ CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) };
+                if( file == INVALID_HANDLE_VALUE )
+                {
+                    return mapping;
+                }
+                LARGE_INTEGER size{};
+                HANDLE handle{ GetFileSizeEx( file, &size ) && size.QuadPart > 0
+                    ? CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) : nullptr };
+                CloseHandle( file );
+                if( !handle )
+                {
+                    return mapping;
+                }
+                mapping.data_ = static_cast<uint8_t*>( MapViewOfFile( handle, FILE_MAP_READ, 0, 0, 0 ) );
+                CloseHandle( handle );
+                mapping.size_ = mapping.data_ ? static_cast<std::size_t>( size.QuadPart ) : 0;
+#else
+                const int fd{ ::open( path, O_RDONLY ) };
+                if( fd < 0 )
+                {
+                    return mapping;
+                }
+                struct stat status{};
+                void* view{ ::fstat( fd, &status ) == 0 && status.st_size > 0
+                    ? ::mmap( nullptr, static_cast<std::size_t>( status.st_size ), PROT_READ, MAP_SHARED, fd, 0 ) : MAP_FAILED };
+                ::close( fd );
+                if( view != MAP_FAILED )
+                {
+                    mapping.data_ = static_cast<uint8_t*>( view );
+                    mapping.size_ = static_cast<std::size_t>( status.st_size );
+                }
+#endif
+                return mapping;
+            }
+
+            //   Creates (or truncates) path with size bytes and maps it for writing.
+            static file_mapping create( const char* path, std::size_t size )
+            {
+                file_mapping mapping;
+                if( size == 0 )
+                {
+                    return mapping;
+                }
+#if defined(_WIN32)
+                HANDLE file{ CreateFileA( path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr ) };
+                if( file == INVALID_HANDLE_VALUE )
+                {
+                    return mapping;
+                }
+                const auto size64{ static_cast<unsigned long long>( size ) };
+                HANDLE handle{ CreateFileMappingA( file, nullptr, PAGE_READWRITE, static_cast<DWORD>( size64 >> 32 ),
+                                                   static_cast<DWORD>( size64 & 0xFF'FF'FF'FF ), nullptr ) };
+                CloseHandle( file );
+                if( !handle )
+                {
+                    return mapping;
+                }
+                mapping.data_ = static_cast<uint8_t*>( MapViewOfFile( handle, FILE_MAP_WRITE, 0, 0, 0 ) );
+                CloseHandle( handle );
+                mapping.size_ = mapping.data_ ? size : 0;
+#else
+                const int fd{ ::open( path, O_RDWR | O_CREAT | O_TRUNC, 0644 ) };
+                if( fd < 0 )
+                {
+                    return mapping;
+                }
+                void* view{ ::ftruncate( fd, static_cast<off_t>( size ) ) == 0
+                    ? ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 ) : MAP_FAILED };
+                ::close( fd );
+                if( view != MAP_FAILED )
+                {
+                    mapping.data_ = static_cast<uint8_t*>( view );
+                    mapping.size_ = size;
+                }
+#endif
+                return mapping;
+            }
+
+            uint8_t* data() const       { return data_; }
+            std::size_t size() const    { return size_; }
+
+            void unmap()
+            {
+                if( data_ )
+                {
+#if defined(_WIN32)
+                    UnmapViewOfFile( data_ );
+#else
+                    ::munmap( data_, size_ );
+#endif
+                }
+                data_ = nullptr;
+                size_ = 0;
+            }
+
+        private:
+            uint8_t*    data_{ nullptr };
+            std::size_t size_{ 0 };
+        };
+
+        //   Reads the whitespace separated tokens of a PPM or PAM header, skipping # comments.
+        struct header_reader
+        {
+            const uint8_t* next;
+            const uint8_t* last;
+
+            static constexpr bool is_space( uint8_t c )
+            {
+                return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+            }
+
+            void skip_space()
+            {
+                while( next < last && ( is_space( *next ) || *next == '#' ) )
+                {
+                    if( *next == '#' )
+                    {
+                        while( next < last && *next != '\n' )
+                        {
+                            ++next;
+                        }
+                    }
+                    else
+                    {
+                        ++next;
+                    }
+                }
+            }
+
+            std::string_view token()
+            {
+                skip_space();
+                const auto* first{ next };
+                while( next < last && !is_space( *next ) )
+                {
+                    ++next;
+                }
+                return { reinterpret_cast<const char*>( first ), static_cast<std::size_t>( next - first ) };
+            }
+
+            //   Returns 0, which no header field may be, if the token isn't a number.
+            std::size_t number()
+            {
+                const auto text{ token() };
+                std::size_t value{ 0 };
+                for( const char c : text )
+                {
+                    if( c < '0' || c > '9' || value > 0xFF'FF'FF )
+                    {
+                        return 0;
+                    }
+                    value = value * 10 + static_cast<std::size_t>( c - '0' );
+                }
+                return value;
+            }
+        };
+
+        //   Reads a PPM or PAM header with a maxval of 255 and 3 or 4 channels.  On success header.next is at the
+        // single whitespace character that separates the header from the pixels.
+        inline bool read_header( header_reader& header, std::size_t& width, std::size_t& height, std::size_t& channels )
+        {
+            const auto magic{ header.token() };
+            std::size_t maxval{ 0 };
+            width = height = channels = 0;
+            if( magic == "P6" )
+            {
+                width = header.number();
+                height = header.number();
+                maxval = header.number();
+                channels = 3;
+            }
+            else if( magic == "P7" )
+            {
+                for( auto key{ header.token() }; !key.empty() && key != "ENDHDR"; key = header.token() )
+                {
+                    if( key == "WIDTH" )        { width = header.number(); }
+                    else if( key == "HEIGHT" )  { height = header.number(); }
+                    else if( key == "DEPTH" )   { channels = header.number(); }
+                    else if( key == "MAXVAL" )  { maxval = header.number(); }
+                    else if( key == "TUPLTYPE" ) { header.token(); }
+                    else                        { return false; }
+                }
+            }
+            return maxval == 255 && width > 0 && height > 0 && ( channels == 3 || channels == 4 ) &&
+                   header.next != header.last && header_reader::is_space( *header.next );
+        }
+
+        inline std::string netpbm_header( image_format format, std::size_t width, std::size_t height )
+        {
+            const auto w{ std::to_string( width ) };
+            const auto h{ std::to_string( height ) };
+            switch( format )
+            {
+            case image_format::ppm:
+                return "P6\n" + w + " " + h + "\n255\n";
+            case image_format::pam:
+                return "P7\nWIDTH " + w + "\nHEIGHT " + h + "\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n";
+            default:
+                return {};
+            }
+        }
+
+        //   Rewrites count ids in place as PAM's big endian samples.
+        inline void to_big_endian( color_id* ids, std::size_t count )
+        {
+            auto* bytes{ reinterpret_cast<uint8_t*>( ids ) };
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                const color_id id{ ids[i] };
+                bytes[i * 2] = static_cast<uint8_t>( id >> 8 );
+                bytes[i * 2 + 1] = static_cast<uint8_t>( id );
+            }
+        }
+
+        //   The header of an index image, padded to an even length so the ids that follow are aligned.
+        inline std::string index_header( std::size_t width, std::size_t height )
+        {
+            auto header{ "P7\nWIDTH " + std::to_string( width ) + "\nHEIGHT " + std::to_string( height ) +
+                         "\nDEPTH 1\nMAXVAL 65535\nTUPLTYPE GRAYSCALE\n# named_colors::color_id\nENDHDR\n" };
+            if( header.size() % 2 != 0 )
+            {
+                header.insert( header.size() - 8, " " );
+            }
+            return header;
+        }
+    }
+
+
+
+    //   A PPM, PAM or raw RGBA8 image mapped read only.
+    class mapped_image
+    {
+    public:
+        //   Opens a binary PPM (P6) or PAM (P7) with a maxval of 255 and 3 or 4 channels.  Returns an image that
+        // converts to false if the file can't be read or is in some other format.
+        static mapped_image open( const char* path )
+        {
+            mapped_image image;
+            image.file_ = detail::file_mapping::open( path );
+            const uint8_t* first{ image.file_.data() };
+            detail::header_reader header{ first, first + image.file_.size() };
+            if( !detail::read_header( header, image.width_, image.height_, image.channels_ ) ||
+                static_cast<std::size_t>( header.last - header.next - 1 ) < image.pixel_count() * image.channels_ )
+            {
+                return {};
+            }
+            image.pixels_ = header.next + 1;
+            return image;
+        }
+
+        //   Opens a file of width * height R, G, B, A bytes and nothing else.
+        static mapped_image open_raw( const char* path, std::size_t width, std::size_t height )
+        {
+            mapped_image image;
+            image.file_ = detail::file_mapping::open( path );
+            if( width == 0 || image.file_.size() != width * height * 4 )
+            {
+                return {};
+            }
+            image.width_ = width;
+            image.height_ = height;
+            image.channels_ = 4;
+            image.pixels_ = image.file_.data();
+            return image;
+        }
+
+        explicit operator bool() const      { return pixels_ != nullptr; }
+        std::size_t width() const           { return width_; }
+        std::size_t height() const          { return height_; }
+        std::size_t pixel_count() const     { return width_ * height_; }
+
+        //   3 for R, G, B pixels or 4 for R, G, B, A.
+        std::size_t channels() const        { return channels_; }
+
+        //   Rows of pixels top to bottom, channels interleaved, no padding.
+        const uint8_t* pixels() const       { return pixels_; }
+
+    private:
+        detail::file_mapping file_;
+        const uint8_t*       pixels_{ nullptr };
+        std::size_t          width_{ 0 };
+        std::size_t          height_{ 0 };
+        std::size_t          channels_{ 0 };
+    };
+
+
+
+    //   A new image file mapped for writing.  The file is complete once close() has been called or the image_output
+    // destroyed.
+    class image_output
+    {
+    public:
+        image_output() = default;
+
+        image_output( image_output&& other ) noexcept
+            : file_( static_cast<detail::file_mapping&&>( other.file_ ) ), data_( other.data_ ), count_( other.count_ ),
+              channels_( other.channels_ ), index_( other.index_ )
+        {
+            other.data_ = nullptr;
+            other.count_ = 0;
+        }
+
+        image_output& operator=( image_output&& other ) noexcept
+        {
+            if( this != &other )
+            {
+                close();
+                file_ = static_cast<detail::file_mapping&&>( other.file_ );
+                data_ = other.data_;
+                count_ = other.count_;
+                channels_ = other.channels_;
+                index_ = other.index_;
+                other.data_ = nullptr;
+                other.count_ = 0;
+            }
+            return *this;
+        }
+
+        image_output( const image_output& ) = delete;
+        image_output& operator=( const image_output& ) = delete;
+
+        ~image_output()
+        {
+            close();
+        }
+
+        //   An image of width * height pixels, 3 channels for ppm and 4 for pam and raw_rgba, to be filled in
+        // through pixels().
+        static image_output create( const char* path, image_format format, std::size_t width, std::size_t height )
+        {
+            const auto header{ detail::netpbm_header( format, width, height ) };
+            const std::size_t channels{ format == image_format::ppm ? 3u : 4u };
+            image_output image;
+            image.file_ = detail::file_mapping::create( path, header.size() + width * height * channels );
+            if( image.file_.data() )
+            {
+                std::memcpy( image.file_.data(), header.data(), header.size() );
+                image.data_ = image.file_.data() + header.size();
+                image.count_ = width * height;
+                image.channels_ = channels;
+            }
+            return image;
+        }
+
+        //   An index image of width * height color_ids, to be filled in through ids().
+        static image_output create_index( const char* path, std::size_t width, std::size_t height )
+        {
+            const auto header{ detail::index_header( width, height ) };
+            image_output image;
+            image.file_ = detail::file_mapping::create( path, header.size() + width * height * sizeof( color_id ) );
+            if( image.file_.data() )
+            {
+                std::memcpy( image.file_.data(), header.data(), header.size() );
+                image.data_ = image.file_.data() + header.size();
+                image.count_ = width * height;
+                image.index_ = true;
+            }
+            return image;
+        }
+
+        explicit operator bool() const      { return data_ != nullptr; }
+        std::size_t pixel_count() const     { return count_; }
+        std::size_t channels() const        { return channels_; }
+
+        //   The pixels of an image from create(), laid out like mapped_image::pixels().
+        uint8_t* pixels() const             { return index_ ? nullptr : data_; }
+
+        //   The ids of an index image from create_index(), in native byte order until close().
+        color_id* ids() const               { return index_ ? reinterpret_cast<color_id*>( data_ ) : nullptr; }
+
+        //   Finishes the file and unmaps it.
+        void close()
+        {
+            if( index_ && data_ )
+            {
+                detail::to_big_endian( reinterpret_cast<color_id*>( data_ ), count_ );
+            }
+            file_.unmap();
+            data_ = nullptr;
+            count_ = 0;
+        }
+
+    private:
+        detail::file_mapping file_;
+        uint8_t*             data_{ nullptr };
+        std::size_t          count_{ 0 };
+        std::size_t          channels_{ 0 };
+        bool                 index_{ false };
+    };
+
+
+
+    //   Writes the CSV legend of an index image: id,name,hex,pixels for each id that occurs in ids, by id.
+    inline bool write_legend( const char* path, const color_id* ids, std::size_t count )
+    {
+        std::vector<std::size_t> pixels( color_count );
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            if( ids[i] < color_count )
+            {
+                ++pixels[ids[i]];
+            }
+        }
+
+        std::string text{ "id,name,hex,pixels\n" };
+        char line[256];
+        for( std::size_t id{ 0 }; id < color_count; ++id )
+        {
+            if( pixels[id] > 0 )
+            {
+                char* const last{ line + sizeof( line ) };
+                char* out{ std::to_chars( line, last, id ).ptr };
+                *out++ = ',';
+                out = detail::put( out, table[id].name );
+                *out++ = ',';
+                out = detail::put_hex( out, table[id].value );
+                *out++ = ',';
+                out = std::to_chars( out, last, pixels[id] ).ptr;
+                *out++ = '\n';
+                text.append( line, out );
+            }
+        }
+        return detail::write_file( path, text.data(), text.size() );
+    }
+
+    //   Writes the index image of image's nearest named colors to index_path and, if legend_path isn't null, its
+    // legend.  Returns false if either file can't be written.
+    inline bool name_image( const mapped_image& image, const char* index_path, const char* legend_path = nullptr )
+    {
+        if( !image )
+        {
+            return false;
+        }
+        auto index{ image_output::create_index( index_path, image.width(), image.height() ) };
+        if( !index )
+        {
+            return false;
+        }
+        nearest( image.pixels(), image.pixel_count(), image.channels(), index.ids() );
+        const bool legend{ !legend_path || write_legend( legend_path, index.ids(), index.pixel_count() ) };
+        index.close();
+        return legend;
+    }
+}
@@ -0,0 +1,287 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Counters on the hot paths of the lookups and searches, to see from real traffic
+// how long probe sequences are, how many candidates the searches look at and how large the batches are, so that
+// tables and index types can be sized from data instead of guesses.
+//
+//   Off by default.  Define NAMED_COLORS_ENABLE_INSTRUMENTATION before including any named_colors header to turn
+// them on.  Without it the hooks are macros that expand to nothing and don't evaluate their arguments, so there is
+// no cost at all.  With it each hook adds to a counter owned by the calling thread, with no locking or shared
+// cache lines; snapshot() adds up every thread's counters.  Lookups evaluated at compile time aren't counted.
+//
+//      using named_colors::instrumentation::counter;
+//      const auto counts{ named_colors::instrumentation::snapshot() };
+//      std::printf( "%.2f probes per find\n", double( counts[counter::find_probes] ) / counts[counter::find_calls] );
+//      std::fputs( named_colors::instrumentation::prometheus_text( counts ).c_str(), metrics_file );
+//
+//   This header can be included either way; without the define, snapshots are all zero.
+//
+//   Requires C++17, and a compiler with __builtin_is_constant_evaluated() (GCC 9, Clang 9, Visual Studio 2019 16.5
+// or later) if instrumentation is enabled and C++20 isn't.
+//
+
+
+
+#include<array>
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<mutex>
+#include<string>
+#include<string_view>
+#include<type_traits>
+#include<utility>
+#include<vector>
+
+
+
+namespace named_colors
+{
+    namespace instrumentation
+    {
+        enum class counter : std::size_t
+        {
+            find_calls,             //  find( name ).
+            find_probes,            //  Hash slots looked at by find().
+            id_of_calls,            //  id_of( color ), and name_of() through it.
+            id_of_probes,           //  Hash slots looked at by id_of().
+            nearest_calls,          //  Single color nearest().
+            nearest_batches,        //  Bulk nearest() calls, for colors or pixels.
+            nearest_items,          //  Colors searched by bulk nearest().
+            nearest_candidates,     //  Named colors compared by nearest(), single and bulk.
+            box_queries,            //  for_each_in_box() and count_in_box().
+            box_candidates,         //  Colors the box queries checked.
+            box_matches,            //  Colors inside the boxes.
+            membership_queries,     //  is_named() colors.
+            bloom_queries,          //  may_be_named() colors.
+            bloom_passes,           //  may_be_named() colors that got past the filter; the rest were settled by it.
+            palette_batches,        //  palette::quantize() and recolor() calls.
+            palette_items,          //  Colors they quantized.
+            scheduler_tiles,        //  Tiles run by work_stealing_scheduler.
+            scheduler_steals        //  Tiles it took from another thread.
+        };
+
+        constexpr std::size_t counter_count{ static_cast<std::size_t>( counter::scheduler_steals ) + 1 };
+
+        //   Prometheus names, without the named_colors_ prefix and _total suffix, and help text.
+        inline constexpr std::array<std::pair<std::string_view, std::string_view>, counter_count> counter_names{ {
+            { "find_calls",         "Name lookups." },
+            { "find_probes",        "Hash slots examined by name lookups." },
+            { "id_of_calls",        "Exact color lookups." },
+            { "id_of_probes",       "Hash slots examined by exact color lookups." },
+            { "nearest_calls",      "Single color nearest named color searches." },
+            { "nearest_batches",    "Bulk nearest named color searches." },
+            { "nearest_items",      "Colors searched by bulk nearest named color searches." },
+            { "nearest_candidates", "Named colors compared by nearest named color searches." },
+            { "box_queries",        "LCh box queries." },
+            { "box_candidates",     "Colors checked by LCh box queries." },
+            { "box_matches",        "Colors found by LCh box queries." },
+            { "membership_queries", "Exact membership tests." },
+            { "bloom_queries",      "Bloom filter membership tests." },
+            { "bloom_passes",       "Bloom filter membership tests that passed the filter." },
+            { "palette_batches",    "Fixed palette quantize calls." },
+            { "palette_items",      "Colors quantized to fixed palettes." },
+            { "scheduler_tiles",    "Tiles run by the work stealing scheduler." },
+            { "scheduler_steals",   "Tiles stolen from another thread's deque." } } };
+
+        //   Batch sizes of bulk nearest() and palette::quantize() are counted in buckets of powers of two: bucket
+        // b holds the batches of at most 2^b colors that didn't fit in bucket b - 1, and the last bucket the rest.
+        constexpr std::size_t batch_buckets{ 26 };
+
+        struct snapshot_data
+        {
+            std::array<uint64_t, counter_count> counters{};
+            std::array<uint64_t, batch_buckets> batch_sizes{};
+            uint64_t                            batch_items{ 0 };     //  Sum of all batch sizes.
+
+            uint64_t operator[]( counter c ) const { return counters[static_cast<std::size_t>( c )]; }
+        };
+
+        constexpr bool enabled
+        {
+#if defined(NAMED_COLORS_ENABLE_INSTRUMENTATION)
+            true
+#else
+            false
+#endif
+        };
+
+        namespace detail
+        {
+            //   One thread's counters.  Only that thread writes them; the atomics let snapshot() read them while it
+            // does.
+            struct counter_block
+            {
+                std::array<std::atomic<uint64_t>, counter_count> counters{};
+                std::array<std::atomic<uint64_t>, batch_buckets> batch_sizes{};
+                std::atomic<uint64_t>                            batch_items{ 0 };
+            };
+
+            struct registry
+            {
+                std::mutex                  mutex;
+                std::vector<counter_block*> live;
+                snapshot_data               retired;      //  Counts of threads that have exited, or been reset away.
+
+                static registry& get()
+                {
+                    static registry instance;
+                    return instance;
+                }
+            };
+
+            inline void add( std::atomic<uint64_t>& value, uint64_t n )
+            {
+                value.store( value.load( std::memory_order_relaxed ) + n, std::memory_order_relaxed );
+            }
+
+            inline void add_to( snapshot_data& total, const counter_block& block )
+            {
+                for( std::size_t i{ 0 }; i < counter_count; ++i )
+                {
+                    total.counters[i] += block.counters[i].load( std::memory_order_relaxed );
+                }
+                for( std::size_t i{ 0 }; i < batch_buckets; ++i )
+                {
+                    total.batch_sizes[i] += block.batch_sizes[i].load( std::memory_order_relaxed );
+                }
+                total.batch_items += block.batch_items.load( std::memory_order_relaxed );
+            }
+
+            struct thread_counters
+            {
+                counter_block block;
+
+                thread_counters()
+                {
+                    auto& r{ registry::get() };
+                    std::lock_guard lock{ r.mutex };
+                    r.live.push_back( &block );
+                }
+
+                ~thread_counters()
+                {
+                    auto& r{ registry::get() };
+                    std::lock_guard lock{ r.mutex };
+                    add_to( r.retired, block );
+                    for( auto& live : r.live )
+                    {
+                        if( live == &block )
+                        {
+                            live = r.live.back();
+                            r.live.pop_back();
+                            break;
+                        }
+                    }
+                }
+            };
+
+            inline counter_block& local()
+            {
+                thread_local thread_counters counters;
+                return counters.block;
+            }
+
+            inline void count( counter c, uint64_t n )
+            {
+                add( local().counters[static_cast<std::size_t>( c )], n );
+            }
+
+            inline void count_batch( uint64_t size )
+            {
+                std::size_t bucket{ 0 };
+                while( bucket + 1 < batch_buckets && size > ( uint64_t{ 1 } << bucket ) )
+                {
+                    ++bucket;
+                }
+                auto& block{ local() };
+                add( block.batch_sizes[bucket], 1 );
+                add( block.batch_items, size );
+            }
+        }
+
+        //   The counts of every thread since the start or the last reset().
+        inline snapshot_data snapshot()
+        {
+            auto& r{ detail::registry::get() };
+            std::lock_guard lock{ r.mutex };
+            snapshot_data total{ r.retired };
+            for( const auto* block : r.live )
+            {
+                detail::add_to( total, *block );
+            }
+            return total;
+        }
+
+        //   Starts counting from zero.  Threads may keep counting while it runs; their counts land on one side of
+        // the reset or the other.
+        inline void reset()
+        {
+            auto& r{ detail::registry::get() };
+            std::lock_guard lock{ r.mutex };
+            snapshot_data total{};
+            for( const auto* block : r.live )
+            {
+                detail::add_to( total, *block );
+            }
+
+            //   Other threads own their blocks, so rather than clearing them the current counts become a debt.
+            for( std::size_t i{ 0 }; i < counter_count; ++i )
+            {
+                r.retired.counters[i] = 0 - total.counters[i];
+            }
+            for( std::size_t i{ 0 }; i < batch_buckets; ++i )
+            {
+                r.retired.batch_sizes[i] = 0 - total.batch_sizes[i];
+            }
+            r.retired.batch_items = 0 - total.batch_items;
+        }
+
+        //   The snapshot in the Prometheus text exposition format: a counter per hook, named
+        // named_colors_<name>_total, and the batch sizes as the histogram named_colors_batch_size.
+        inline std::string prometheus_text( const snapshot_data& data )
+        {
+            std::string text;
+            for( std::size_t i{ 0 }; i < counter_count; ++i )
+            {
+                const auto& [name, help]{ counter_names[i] };
+                const std::string metric{ "named_colors_" + std::string{ name } + "_total" };
+                text += "# HELP " + metric + " " + std::string{ help } + "\n";
+                text += "# TYPE " + metric + " counter\n";
+                text += metric + " " + std::to_string( data.counters[i] ) + "\n";
+            }
+
+            text += "# HELP named_colors_batch_size Colors per bulk nearest or quantize call.\n";
+            text += "# TYPE named_colors_batch_size histogram\n";
+            uint64_t cumulative{ 0 };
+            for( std::size_t b{ 0 }; b < batch_buckets; ++b )
+            {
+                cumulative += data.batch_sizes[b];
+                const std::string le{ b + 1 < batch_buckets ? std::to_string( uint64_t{ 1 } << b ) : "+Inf" };
+                text += "named_colors_batch_size_bucket{le=\"" + le + "\"} " + std::to_string( cumulative ) + "\n";
+            }
+            text += "named_colors_batch_size_sum " + std::to_string( data.batch_items ) + "\n";
+            text += "named_colors_batch_size_count " + std::to_string( cumulative ) + "\n";
+            return text;
+        }
+    }
+}
+
+
+
+//   The hooks.  name is an instrumentation::counter; n and size are only evaluated when instrumentation is on.
+#if defined(NAMED_COLORS_ENABLE_INSTRUMENTATION)
+#   if defined(__cpp_lib_is_constant_evaluated)
+#       define NAMED_COLORS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#   else
+#       define NAMED_COLORS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#   endif
+#   define NAMED_COLORS_COUNT( name, n ) \
+        ( NAMED_COLORS_CONSTANT_EVALUATED() ? static_cast<void>( 0 ) \
+            : ::named_colors::instrumentation::detail::count( ::named_colors::instrumentation::counter::name, static_cast<uint64_t>( n ) ) )
+#   define NAMED_COLORS_COUNT_BATCH( size ) \
+        ( NAMED_COLORS_CONSTANT_EVALUATED() ? static_cast<void>( 0 ) \
+            : ::named_colors::instrumentation::detail::count_batch( static_cast<uint64_t>( size ) ) )
+#endif
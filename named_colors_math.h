@@ -0,0 +1,357 @@
+#pragma once
+
+
+//
+//   Compile time math and color space helpers shared by the companion headers.  The standard <cmath> functions
+// aren't constexpr before C++26, so the few that are needed are implemented here well enough to be accurate to
+// about a unit in the last place of a double over the ranges they are used for.
+//
+//   Requires C++17.
+//
+
+
+
+#include<array>
+#include<cstddef>
+#include<cstdint>
+
+
+
+namespace named_colors
+{
+    namespace detail
+    {
+        constexpr double ln2{ 0.693147180559945309417232121458176568 };
+
+        constexpr double abs( double x )
+        {
+            return x < 0.0 ? -x : x;
+        }
+
+        //   x = m * 2^e with m in [1, 2), then log( m ) = 2 * atanh( ( m - 1 ) / ( m + 1 ) ).
+        constexpr double log( double x )
+        {
+            if( x <= 0.0 )
+            {
+                return -1.0e308;
+            }
+            int exponent{ 0 };
+            while( x >= 2.0 )
+            {
+                x *= 0.5;
+                ++exponent;
+            }
+            while( x < 1.0 )
+            {
+                x *= 2.0;
+                --exponent;
+            }
+            const double t{ ( x - 1.0 ) / ( x + 1.0 ) };
+            const double t2{ t * t };
+            double term{ t };
+            double sum{ 0.0 };
+            for( int k{ 1 }; k < 40; k += 2 )
+            {
+                sum += term / k;
+                term *= t2;
+            }
+            return 2.0 * sum + exponent * ln2;
+        }
+
+        //   x = k * ln2 + r with |r| <= ln2 / 2, then a Taylor series for exp( r ).
+        constexpr double exp( double x )
+        {
+            if( x < -745.0 )
+            {
+                return 0.0;
+            }
+            const auto k{ static_cast<int>( x / ln2 + ( x < 0.0 ? -0.5 : 0.5 ) ) };
+            const double r{ x - k * ln2 };
+            double term{ 1.0 };
+            double sum{ 1.0 };
+            for( int n{ 1 }; n < 24; ++n )
+            {
+                term *= r / n;
+                sum += term;
+            }
+            for( int i{ 0 }; i < k; ++i )
+            {
+                sum *= 2.0;
+            }
+            for( int i{ 0 }; i > k; --i )
+            {
+                sum *= 0.5;
+            }
+            return sum;
+        }
+
+        constexpr double pow( double base, double exponent )
+        {
+            return base == 0.0 ? 0.0 : exp( exponent * log( base ) );
+        }
+
+        constexpr double sqrt( double x )
+        {
+            if( x <= 0.0 )
+            {
+                return 0.0;
+            }
+            double guess{ x < 1.0 ? 1.0 : x };
+            for( int i{ 0 }; i < 64; ++i )
+            {
+                const double next{ 0.5 * ( guess + x / guess ) };
+                if( next == guess )
+                {
+                    break;
+                }
+                guess = next;
+            }
+            return guess;
+        }
+
+        constexpr double cbrt( double x )
+        {
+            if( x == 0.0 )
+            {
+                return 0.0;
+            }
+            if( x < 0.0 )
+            {
+                return -cbrt( -x );
+            }
+            //   Scale into [1/8, 1) so a handful of Newton steps from a linear first guess are enough.
+            double scale{ 1.0 };
+            while( x >= 1.0 )
+            {
+                x *= 0.125;
+                scale *= 2.0;
+            }
+            while( x < 0.125 )
+            {
+                x *= 8.0;
+                scale *= 0.5;
+            }
+            double guess{ 0.4 + 0.6 * x };
+            for( int i{ 0 }; i < 8; ++i )
+            {
+                guess -= ( guess * guess * guess - x ) / ( 3.0 * guess * guess );
+            }
+            return guess * scale;
+        }
+
+        constexpr double pi{ 3.14159265358979323846264338327950288 };
+
+        //   Halve the argument twice with atan( x ) = 2 * atan( x / ( 1 + sqrt( 1 + x^2 ) ) ) so the Taylor series
+        // converges quickly, then undo it.
+        constexpr double atan( double x )
+        {
+            if( x < 0.0 )
+            {
+                return -atan( -x );
+            }
+            if( x > 1.0 )
+            {
+                return pi / 2.0 - atan( 1.0 / x );
+            }
+            for( int i{ 0 }; i < 2; ++i )
+            {
+                x = x / ( 1.0 + sqrt( 1.0 + x * x ) );
+            }
+            const double x2{ x * x };
+            double term{ x };
+            double sum{ 0.0 };
+            for( int k{ 0 }; k < 24; ++k )
+            {
+                sum += ( k % 2 ? -term : term ) / ( 2 * k + 1 );
+                term *= x2;
+            }
+            return 4.0 * sum;
+        }
+
+        constexpr double atan2( double y, double x )
+        {
+            if( x > 0.0 )
+            {
+                return atan( y / x );
+            }
+            if( x < 0.0 )
+            {
+                return atan( y / x ) + ( y < 0.0 ? -pi : pi );
+            }
+            return y > 0.0 ? pi / 2.0 : y < 0.0 ? -pi / 2.0 : 0.0;
+        }
+    }
+
+
+
+    //   sRGB transfer functions (IEC 61966-2-1) on normalized values.
+    constexpr double srgb_to_linear( double encoded )
+    {
+        return encoded <= 0.04045 ? encoded / 12.92 : detail::pow( ( encoded + 0.055 ) / 1.055, 2.4 );
+    }
+
+    constexpr double linear_to_srgb( double linear )
+    {
+        return linear <= 0.0031308 ? linear * 12.92 : 1.055 * detail::pow( linear, 1.0 / 2.4 ) - 0.055;
+    }
+
+    namespace detail
+    {
+        constexpr std::array<double, 256> make_linear_table()
+        {
+            std::array<double, 256> table{};
+            for( std::size_t i{ 0 }; i < table.size(); ++i )
+            {
+                table[i] = srgb_to_linear( static_cast<double>( i ) / 255.0 );
+            }
+            return table;
+        }
+    }
+
+    //   srgb_to_linear() of every 8 bit channel value.
+    inline constexpr std::array<double, 256> linear_table{ detail::make_linear_table() };
+
+
+
+    //   CIE 1931 XYZ with a D65 white point, Y of white is 1.
+    struct xyz
+    {
+        double x;
+        double y;
+        double z;
+    };
+
+    //   CIE L*a*b* (D65), L from 0 to 100.
+    struct lab
+    {
+        double l;
+        double a;
+        double b;
+    };
+
+    //   Polar form of lab: lightness, chroma, and hue in degrees [0, 360).
+    struct lch
+    {
+        double l;
+        double c;
+        double h;
+    };
+
+    //   0xRRGGBBAA to XYZ; alpha is ignored.
+    constexpr xyz to_xyz( uint32_t color )
+    {
+        const double r{ linear_table[static_cast<uint8_t>( color >> 24 )] };
+        const double g{ linear_table[static_cast<uint8_t>( color >> 16 )] };
+        const double b{ linear_table[static_cast<uint8_t>( color >> 8 )] };
+        return {
+            0.4124564 * r + 0.3575761 * g + 0.1804375 * b,
+            0.2126729 * r + 0.7151522 * g + 0.0721750 * b,
+            0.0193339 * r + 0.1191920 * g + 0.9503041 * b };
+    }
+
+    namespace detail
+    {
+        constexpr double lab_f( double t )
+        {
+            constexpr double delta{ 6.0 / 29.0 };
+            return t > delta * delta * delta ? cbrt( t ) : t / ( 3.0 * delta * delta ) + 4.0 / 29.0;
+        }
+    }
+
+    constexpr lab to_lab( const xyz& c )
+    {
+        const double fx{ detail::lab_f( c.x / 0.95047 ) };
+        const double fy{ detail::lab_f( c.y ) };
+        const double fz{ detail::lab_f( c.z / 1.08883 ) };
+        return { 116.0 * fy - 16.0, 500.0 * ( fx - fy ), 200.0 * ( fy - fz ) };
+    }
+
+    constexpr lab to_lab( uint32_t color )
+    {
+        return to_lab( to_xyz( color ) );
+    }
+
+    constexpr lch to_lch( const lab& c )
+    {
+        double hue{ detail::atan2( c.b, c.a ) * 180.0 / detail::pi };
+        if( hue < 0.0 )
+        {
+            hue += 360.0;
+        }
+        return { c.l, detail::sqrt( c.a * c.a + c.b * c.b ), hue >= 360.0 ? 0.0 : hue };
+    }
+
+    constexpr lch to_lch( uint32_t color )
+    {
+        return to_lch( to_lab( color ) );
+    }
+
+
+
+    //   sRGB primaries with the transfer function removed, each channel normalized.
+    struct linear_rgb
+    {
+        double r;
+        double g;
+        double b;
+    };
+
+    //   Björn Ottosson's OKLab.  L goes from 0 to 1 and a perceptual distance is the euclidean distance.
+    struct oklab
+    {
+        double l;
+        double a;
+        double b;
+    };
+
+    constexpr linear_rgb to_linear( uint32_t color )
+    {
+        return {
+            linear_table[static_cast<uint8_t>( color >> 24 )],
+            linear_table[static_cast<uint8_t>( color >> 16 )],
+            linear_table[static_cast<uint8_t>( color >> 8 )] };
+    }
+
+    constexpr oklab to_oklab( const linear_rgb& c )
+    {
+        const double l{ detail::cbrt( 0.4122214708 * c.r + 0.5363292134 * c.g + 0.0514459929 * c.b ) };
+        const double m{ detail::cbrt( 0.2119034982 * c.r + 0.6806995451 * c.g + 0.1073969566 * c.b ) };
+        const double s{ detail::cbrt( 0.0883024619 * c.r + 0.2817188376 * c.g + 0.6299787005 * c.b ) };
+        return {
+            0.2104542553 * l + 0.7936177850 * m - 0.0040720468 * s,
+            1.9779984951 * l - 2.4285922050 * m + 0.4505937099 * s,
+            0.0259040371 * l + 0.7827717662 * m - 0.8086757660 * s };
+    }
+
+    constexpr oklab to_oklab( uint32_t color )
+    {
+        return to_oklab( to_linear( color ) );
+    }
+
+    constexpr linear_rgb to_linear( const oklab& c )
+    {
+        const double l_{ c.l + 0.3963377774 * c.a + 0.2158037573 * c.b };
+        const double m_{ c.l - 0.1055613458 * c.a - 0.0638541728 * c.b };
+        const double s_{ c.l - 0.0894841775 * c.a - 1.2914855480 * c.b };
+        const double l{ l_ * l_ * l_ };
+        const double m{ m_ * m_ * m_ };
+        const double s{ s_ * s_ * s_ };
+        return {
+            4.0767416621 * l - 3.3077115913 * m + 0.2309699292 * s,
+            -1.2684380046 * l + 2.6097574011 * m - 0.3413193965 * s,
+            -0.0041960863 * l - 0.7034186147 * m + 1.7076147010 * s };
+    }
+
+    //   Linear channel to an 8 bit sRGB channel, clamped and rounded to nearest.
+    constexpr uint8_t to_srgb8( double linear )
+    {
+        const double encoded{ linear <= 0.0 ? 0.0 : linear >= 1.0 ? 1.0 : linear_to_srgb( linear ) };
+        return static_cast<uint8_t>( encoded * 255.0 + 0.5 );
+    }
+
+    constexpr uint32_t to_hex( const linear_rgb& c, uint8_t alpha = 0xff )
+    {
+        return ( static_cast<uint32_t>( to_srgb8( c.r ) ) << 24 ) | ( static_cast<uint32_t>( to_srgb8( c.g ) ) << 16 ) |
+               ( static_cast<uint32_t>( to_srgb8( c.b ) ) << 8 ) | alpha;
+    }
+}
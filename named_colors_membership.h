@@ -0,0 +1,187 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Answers "is this exactly a named color?" for large numbers of pixels without a
+// hash lookup per pixel.
+//
+//   is_named() is exact and reads one bit from a 2^24 bit (2 MB) set indexed by the RGB value.  The set is a static
+// that is filled the first time it is used rather than a constexpr table: as a constant it would add 2 MB to every
+// binary including this header and take most compilers past their constant evaluation limits, whereas filling it
+// at run time is one pass over the 896 distinct values into zeroed memory.
+//
+//   may_be_named() uses a 4 KB split block Bloom filter instead, which is built at compile time and stays in L1.
+// Each value sets one bit in each of the eight 32 bit words of one 32 byte block, so a probe is a single block
+// read with no dependent loads.  It never misses a named color and wrongly accepts about 1 in 80000 other values,
+// so it suits a fast first pass in front of is_named() or id_of().
+//
+//   The array versions have no branches in their loops.  The bit set is the faster of the two as long as it stays
+// in cache; the filter is for when the pixels are probed alongside other work that needs the cache.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<array>
+#include<cstddef>
+#include<cstdint>
+
+
+
+namespace named_colors
+{
+    namespace detail
+    {
+        constexpr uint32_t rgb_of( uint32_t color )
+        {
+            return color >> 8;
+        }
+
+        inline const std::array<uint64_t, ( 1 << 24 ) / 64>& membership_bits()
+        {
+            static const auto* const bits{ []
+            {
+                static std::array<uint64_t, ( 1 << 24 ) / 64> filled{};
+                for( const auto value : canonical_values )
+                {
+                    filled[rgb_of( value ) / 64] |= uint64_t{ 1 } << ( rgb_of( value ) % 64 );
+                }
+                return &filled;
+            }() };
+            return *bits;
+        }
+    }
+
+    //   Exact, alpha ignored.
+    inline bool is_named( uint32_t color )
+    {
+        NAMED_COLORS_COUNT( membership_queries, 1 );
+        const auto rgb{ detail::rgb_of( color ) };
+        return ( detail::membership_bits()[rgb / 64] >> ( rgb % 64 ) ) & 1;
+    }
+
+    inline void is_named( const uint32_t* colors, std::size_t count, bool* named )
+    {
+        NAMED_COLORS_COUNT( membership_queries, count );
+        const auto& bits{ detail::membership_bits() };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            const auto rgb{ detail::rgb_of( colors[i] ) };
+            named[i] = ( bits[rgb / 64] >> ( rgb % 64 ) ) & 1;
+        }
+    }
+
+    inline std::size_t count_named( const uint32_t* colors, std::size_t count )
+    {
+        NAMED_COLORS_COUNT( membership_queries, count );
+        const auto& bits{ detail::membership_bits() };
+        std::size_t named{ 0 };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            const auto rgb{ detail::rgb_of( colors[i] ) };
+            named += ( bits[rgb / 64] >> ( rgb % 64 ) ) & 1;
+        }
+        return named;
+    }
+
+
+
+    namespace detail
+    {
+        constexpr std::size_t bloom_blocks{ 128 };
+
+        using bloom_block = std::array<uint32_t, 8>;
+
+        //   Odd multipliers that pick the bit within each word, from the Parquet split block filter.
+        inline constexpr bloom_block bloom_salts{ {
+            0x47'B6'13'7B, 0x44'97'4D'91, 0x8C'B7'CA'A9, 0xA8'AB'AB'55,
+            0x70'5B'0D'A5, 0x2D'F1'42'4B, 0x9E'FC'49'75, 0x5C'6B'FB'31 } };
+
+        constexpr uint64_t bloom_hash( uint32_t color )
+        {
+            return ( static_cast<uint64_t>( rgb_of( color ) ) + 1 ) * 0x9E'37'79'B9'7F'4A'7C'15;
+        }
+
+        constexpr std::size_t bloom_block_of( uint64_t hash )
+        {
+            return static_cast<std::size_t>( hash >> 57 );
+        }
+
+        constexpr uint32_t bloom_bit( uint64_t hash, std::size_t word )
+        {
+            return uint32_t{ 1 } << ( ( static_cast<uint32_t>( hash ) * bloom_salts[word] ) >> 27 );
+        }
+
+        constexpr std::array<bloom_block, bloom_blocks> make_bloom_filter()
+        {
+            std::array<bloom_block, bloom_blocks> blocks{};
+            for( const auto value : canonical_values )
+            {
+                const auto hash{ bloom_hash( value ) };
+                for( std::size_t word{ 0 }; word < 8; ++word )
+                {
+                    blocks[bloom_block_of( hash )][word] |= bloom_bit( hash, word );
+                }
+            }
+            return blocks;
+        }
+
+        inline constexpr std::array<bloom_block, bloom_blocks> bloom_filter{ make_bloom_filter() };
+        static_assert( bloom_blocks == 1 << ( 64 - 57 ) );
+
+        constexpr bool bloom_contains( uint32_t color )
+        {
+            const auto hash{ bloom_hash( color ) };
+            const auto& block{ bloom_filter[bloom_block_of( hash )] };
+            uint32_t missing{ 0 };
+            for( std::size_t word{ 0 }; word < 8; ++word )
+            {
+                missing |= bloom_bit( hash, word ) & ~block[word];
+            }
+            return missing == 0;
+        }
+    }
+
+    //   True for every named color and for very few others.
+    constexpr bool may_be_named( uint32_t color )
+    {
+        const bool maybe{ detail::bloom_contains( color ) };
+        NAMED_COLORS_COUNT( bloom_queries, 1 );
+        NAMED_COLORS_COUNT( bloom_passes, maybe );
+        return maybe;
+    }
+
+    //   Hashes a block of colors first, then probes, so both loops have independent iterations.
+    inline void may_be_named( const uint32_t* colors, std::size_t count, bool* named )
+    {
+        constexpr std::size_t block{ 64 };
+        uint32_t hashes[block];
+        uint32_t blocks[block];
+        for( std::size_t first{ 0 }; first < count; first += block )
+        {
+            const std::size_t n{ count - first < block ? count - first : block };
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                const auto hash{ detail::bloom_hash( colors[first + i] ) };
+                hashes[i] = static_cast<uint32_t>( hash );
+                blocks[i] = static_cast<uint32_t>( detail::bloom_block_of( hash ) );
+            }
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                const auto& words{ detail::bloom_filter[blocks[i]] };
+                uint32_t missing{ 0 };
+                for( std::size_t word{ 0 }; word < 8; ++word )
+                {
+                    missing |= detail::bloom_bit( hashes[i], word ) & ~words[word];
+                }
+                named[first + i] = missing == 0;
+            }
+        }
+        NAMED_COLORS_COUNT( bloom_queries, count );
+        NAMED_COLORS_COUNT( bloom_passes, std::count( named, named + count, true ) );
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  OKLab coordinates of every named color, computed at compile time and stored as
+// three separate float arrays so that loops over all colors vectorize, plus a nearest named color search by
+// perceptual (OKLab) distance rather than by RGB distance.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_table.h"
+
+#include<array>
+#include<cstddef>
+#include<cstdint>
+
+
+
+namespace named_colors
+{
+    template<std::size_t N>
+    struct oklab_points
+    {
+        alignas( 32 ) std::array<float, N> l;
+        alignas( 32 ) std::array<float, N> a;
+        alignas( 32 ) std::array<float, N> b;
+    };
+
+    namespace detail
+    {
+        constexpr oklab_points<color_count> make_oklab_table()
+        {
+            oklab_points<color_count> points{};
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                const auto c{ to_oklab( table[id].value ) };
+                points.l[id] = static_cast<float>( c.l );
+                points.a[id] = static_cast<float>( c.a );
+                points.b[id] = static_cast<float>( c.b );
+            }
+            return points;
+        }
+    }
+
+    //   to_oklab() of every named color, indexed by color_id.
+    inline constexpr oklab_points<color_count> oklab_table{ detail::make_oklab_table() };
+
+    namespace detail
+    {
+        constexpr oklab_points<canonical_count> make_canonical_oklab()
+        {
+            oklab_points<canonical_count> points{};
+            for( std::size_t i{ 0 }; i < canonical_count; ++i )
+            {
+                points.l[i] = oklab_table.l[canonical_ids[i]];
+                points.a[i] = oklab_table.a[canonical_ids[i]];
+                points.b[i] = oklab_table.b[canonical_ids[i]];
+            }
+            return points;
+        }
+
+        //   The same for each canonical id, indexed by canonical_index(), for the search loops.
+        inline constexpr oklab_points<canonical_count> canonical_oklab{ make_canonical_oklab() };
+    }
+
+    constexpr float oklab_distance_squared( color_id lhs, color_id rhs )
+    {
+        const float dl{ oklab_table.l[lhs] - oklab_table.l[rhs] };
+        const float da{ oklab_table.a[lhs] - oklab_table.a[rhs] };
+        const float db{ oklab_table.b[lhs] - oklab_table.b[rhs] };
+        return dl * dl + da * da + db * db;
+    }
+
+    //   Id of the named color closest to c in OKLab.  Ties go to the lowest id, which is always a canonical id.
+    inline color_id nearest_oklab( const oklab& c )
+    {
+        const auto& points{ detail::canonical_oklab };
+        const auto l{ static_cast<float>( c.l ) };
+        const auto a{ static_cast<float>( c.a ) };
+        const auto b{ static_cast<float>( c.b ) };
+        std::size_t best{ 0 };
+        float best_distance{ 1.0e30f };
+        for( std::size_t i{ 0 }; i < canonical_count; ++i )
+        {
+            const float dl{ points.l[i] - l };
+            const float da{ points.a[i] - a };
+            const float db{ points.b[i] - b };
+            const float distance{ dl * dl + da * da + db * db };
+            if( distance < best_distance )
+            {
+                best = i;
+                best_distance = distance;
+            }
+        }
+        return canonical_ids[best];
+    }
+
+    inline color_id nearest_oklab( uint32_t color )
+    {
+        return nearest_oklab( to_oklab( color ) );
+    }
+}
@@ -0,0 +1,246 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Fixed palettes of a few named colors chosen at compile time, for products that
+// only ever use a handful of them:
+//
+//      constexpr auto brand{ named_colors::make_palette( hex_color::NAVY_BLUE, hex_color::TEAL, hex_color::GOLD ) };
+//      const auto index{ brand.nearest( pixel ) };     //  0, 1 or 2
+//
+//   The size is part of the type, so searches only look at the palette's own colors and the loop over them is
+// unrolled completely.  quantize() takes pixels a block at a time and compares each palette color with the whole
+// block, which leaves a branch free loop over pixels for the compiler to vectorize.  Everything except quantize()
+// is constexpr, including the palette itself and its lookup of exact colors.
+//
+//   quantize() and recolor() also take pixels as interleaved 8 bit channels, as named_colors_image.h maps them
+// from image files.
+//
+//   Distances are distance_squared(), as for named_colors::nearest(), and ties go to the lowest index.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_table.h"
+
+#include<array>
+#include<cstddef>
+#include<cstdint>
+#include<type_traits>
+#include<utility>
+
+
+
+namespace named_colors
+{
+    template<std::size_t N>
+    class palette
+    {
+        static_assert( N > 0 && N <= 65535, "a palette has between 1 and 65535 colors" );
+
+    public:
+        //   Smallest unsigned type that holds every index.
+        using index_type = std::conditional_t<( N <= 256 ), uint8_t, uint16_t>;
+
+        static constexpr std::size_t npos{ N };
+
+        constexpr explicit palette( const std::array<uint32_t, N>& colors )
+        {
+            for( std::size_t i{ 0 }; i < N; ++i )
+            {
+                values_[i] = colors[i];
+                ids_[i] = id_of( colors[i] );
+                r_[i] = red( colors[i] );
+                g_[i] = green( colors[i] );
+                b_[i] = blue( colors[i] );
+                by_value_[i] = static_cast<index_type>( i );
+            }
+
+            //   Insertion sort, so index_of() can binary search.  Palettes are small.
+            for( std::size_t i{ 1 }; i < N; ++i )
+            {
+                for( std::size_t j{ i }; j > 0 && less( by_value_[j], by_value_[j - 1] ); --j )
+                {
+                    const auto swapped{ by_value_[j] };
+                    by_value_[j] = by_value_[j - 1];
+                    by_value_[j - 1] = swapped;
+                }
+            }
+        }
+
+        static constexpr std::size_t size() { return N; }
+
+        constexpr uint32_t operator[]( std::size_t index ) const { return values_[index]; }
+
+        //   Id in named_colors::table of each color, or no_color for colors that aren't named.
+        constexpr color_id id( std::size_t index ) const { return ids_[index]; }
+
+        constexpr const std::array<uint32_t, N>& values() const { return values_; }
+
+        //   Index of the color exactly equal to color, alpha ignored, or npos.
+        constexpr std::size_t index_of( uint32_t color ) const
+        {
+            std::size_t first{ 0 };
+            std::size_t last{ N };
+            while( first < last )
+            {
+                const std::size_t middle{ first + ( last - first ) / 2 };
+                if( ( values_[by_value_[middle]] >> 8 ) < ( color >> 8 ) )
+                {
+                    first = middle + 1;
+                }
+                else
+                {
+                    last = middle;
+                }
+            }
+            return first < N && ( values_[by_value_[first]] >> 8 ) == ( color >> 8 ) ? by_value_[first] : npos;
+        }
+
+        //   Index of the closest palette color.
+        constexpr std::size_t nearest( uint32_t color ) const
+        {
+            return nearest( red( color ), green( color ), blue( color ), std::make_index_sequence<N>{} );
+        }
+
+        //   Writes the index of the closest palette color of each of count colors.
+        void quantize( const uint32_t* colors, std::size_t count, index_type* indices ) const
+        {
+            run( count, [colors]( std::size_t i ) { return colors[i]; },
+                 [indices]( std::size_t i, int32_t best ) { indices[i] = static_cast<index_type>( best ); } );
+        }
+
+        //   Same, for count pixels of interleaved 8 bit R, G, B (and alpha, when channels is 4) channels.
+        void quantize( const uint8_t* pixels, std::size_t count, std::size_t channels, index_type* indices ) const
+        {
+            run( count, load_pixel( pixels, channels ),
+                 [indices]( std::size_t i, int32_t best ) { indices[i] = static_cast<index_type>( best ); } );
+        }
+
+        //   Replaces each of count colors with the closest palette color, keeping its alpha.
+        void quantize( const uint32_t* colors, std::size_t count, uint32_t* quantized ) const
+        {
+            run( count, [colors]( std::size_t i ) { return colors[i]; }, [this, colors, quantized]( std::size_t i, int32_t best )
+            {
+                quantized[i] = ( values_[static_cast<std::size_t>( best )] & 0xFF'FF'FF'00 ) | alpha( colors[i] );
+            } );
+        }
+
+        //   Writes count pixels, laid out like the input, with each color replaced by the closest palette color.
+        // Alpha is kept.  out may be pixels.
+        void recolor( const uint8_t* pixels, std::size_t count, std::size_t channels, uint8_t* out ) const
+        {
+            run( count, load_pixel( pixels, channels ), [this, channels, out]( std::size_t i, int32_t best )
+            {
+                uint8_t* p{ out + i * channels };
+                p[0] = r_[static_cast<std::size_t>( best )];
+                p[1] = g_[static_cast<std::size_t>( best )];
+                p[2] = b_[static_cast<std::size_t>( best )];
+            } );
+        }
+
+    private:
+        constexpr bool less( std::size_t lhs, std::size_t rhs ) const
+        {
+            return ( values_[lhs] >> 8 ) < ( values_[rhs] >> 8 ) || ( ( values_[lhs] >> 8 ) == ( values_[rhs] >> 8 ) && lhs < rhs );
+        }
+
+        template<std::size_t... I>
+        constexpr std::size_t nearest( int r, int g, int b, std::index_sequence<I...> ) const
+        {
+            std::size_t best{ 0 };
+            int best_distance{ 3 * 255 * 255 + 1 };
+            const auto visit{ [&]( std::size_t i )
+            {
+                const int dr{ r_[i] - r };
+                const int dg{ g_[i] - g };
+                const int db{ b_[i] - b };
+                const int distance{ dr * dr + dg * dg + db * db };
+                best = distance < best_distance ? i : best;
+                best_distance = distance < best_distance ? distance : best_distance;
+            } };
+            ( visit( I ), ... );
+            return best;
+        }
+
+        static constexpr auto load_pixel( const uint8_t* pixels, std::size_t channels )
+        {
+            return [pixels, channels]( std::size_t i )
+            {
+                const uint8_t* p{ pixels + i * channels };
+                return rgba( p[0], p[1], p[2] );
+            };
+        }
+
+        //   Calls store( i, index ) for each of count colors, where load( i ) is the color.
+        template<typename Load, typename Store>
+        void run( std::size_t count, Load load, Store store ) const
+        {
+            NAMED_COLORS_COUNT( palette_batches, 1 );
+            NAMED_COLORS_COUNT( palette_items, count );
+            NAMED_COLORS_COUNT_BATCH( count );
+            constexpr std::size_t block{ 64 };
+            alignas( 32 ) int32_t r[block];
+            alignas( 32 ) int32_t g[block];
+            alignas( 32 ) int32_t b[block];
+            alignas( 32 ) int32_t best_distance[block];
+            alignas( 32 ) int32_t best[block];
+            for( std::size_t first{ 0 }; first < count; first += block )
+            {
+                const std::size_t n{ count - first < block ? count - first : block };
+                for( std::size_t i{ 0 }; i < block; ++i )
+                {
+                    const uint32_t color{ i < n ? load( first + i ) : 0 };
+                    r[i] = red( color );
+                    g[i] = green( color );
+                    b[i] = blue( color );
+                    best_distance[i] = 3 * 255 * 255 + 1;
+                    best[i] = 0;
+                }
+                compare_block( r, g, b, best_distance, best, std::make_index_sequence<N>{} );
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    store( first + i, best[i] );
+                }
+            }
+        }
+
+        template<std::size_t... I>
+        void compare_block( const int32_t* r, const int32_t* g, const int32_t* b, int32_t* best_distance, int32_t* best, std::index_sequence<I...> ) const
+        {
+            const auto visit{ [&]( std::size_t c )
+            {
+                const int32_t cr{ r_[c] };
+                const int32_t cg{ g_[c] };
+                const int32_t cb{ b_[c] };
+                for( std::size_t i{ 0 }; i < 64; ++i )
+                {
+                    const int32_t dr{ r[i] - cr };
+                    const int32_t dg{ g[i] - cg };
+                    const int32_t db{ b[i] - cb };
+                    const int32_t distance{ dr * dr + dg * dg + db * db };
+                    const bool closer{ distance < best_distance[i] };
+                    best_distance[i] = closer ? distance : best_distance[i];
+                    best[i] = closer ? static_cast<int32_t>( c ) : best[i];
+                }
+            } };
+            ( visit( I ), ... );
+        }
+
+        std::array<uint32_t, N>   values_{};
+        std::array<color_id, N>   ids_{};
+        std::array<uint8_t, N>    r_{};
+        std::array<uint8_t, N>    g_{};
+        std::array<uint8_t, N>    b_{};
+        std::array<index_type, N> by_value_{};     //  Indices sorted by value, for index_of().
+    };
+
+    //   A palette of the given colors, in order, e.g. make_palette( hex_color::RED, hex_color::TEAL ).
+    template<typename... Colors>
+    constexpr palette<sizeof...( Colors )> make_palette( Colors... colors )
+    {
+        return palette<sizeof...( Colors )>{ std::array<uint32_t, sizeof...( Colors )>{ static_cast<uint32_t>( colors )... } };
+    }
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Indexes the named colors by CIE LCh lightness, chroma and hue so that questions
+// like "all named blues lighter than L=70" don't need to look at every color.
+//
+//   Each index is the list of canonical ids sorted by one key, so aliases are only returned once, under the first
+// of their names; aliases() in named_colors_table.h gives the others.  A range of one key is found with two binary
+// searches and is returned as a span into the index, so nothing is allocated.  Hue ranges may wrap around 0
+// degrees, in which case they are two spans.  Box queries over all three keys walk the smallest of the three
+// candidate spans and check the other two keys of each color.
+//
+//   All ranges are inclusive.  Lightness goes from 0 to 100, chroma from 0 to about 134 for sRGB colors, and hue
+// is in degrees from 0 up to but not including 360.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<array>
+#include<cstddef>
+#include<cstdint>
+
+
+
+namespace named_colors
+{
+    namespace detail
+    {
+        constexpr std::array<lch, color_count> make_lch_table()
+        {
+            std::array<lch, color_count> colors{};
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                colors[id] = to_lch( table[id].value );
+
+                //   Rounding puts white a hair above 100, which would leave it out of ranges ending at 100.
+                colors[id].l = colors[id].l > 100.0 ? 100.0 : colors[id].l;
+            }
+            return colors;
+        }
+    }
+
+    //   to_lch() of every named color, indexed by color_id.
+    inline constexpr std::array<lch, color_count> lch_table{ detail::make_lch_table() };
+
+    namespace detail
+    {
+        template<double lch::*Key>
+        constexpr std::array<color_id, canonical_count> make_lch_order()
+        {
+            std::array<color_id, canonical_count> ids{ canonical_ids };
+            sort_ids( ids, []( color_id lhs, color_id rhs )
+            {
+                return lch_table[lhs].*Key < lch_table[rhs].*Key || ( lch_table[lhs].*Key == lch_table[rhs].*Key && lhs < rhs );
+            } );
+            return ids;
+        }
+
+        template<double lch::*Key>
+        constexpr std::array<double, canonical_count> make_sorted_keys( const std::array<color_id, canonical_count>& order )
+        {
+            std::array<double, canonical_count> keys{};
+            for( std::size_t i{ 0 }; i < canonical_count; ++i )
+            {
+                keys[i] = lch_table[order[i]].*Key;
+            }
+            return keys;
+        }
+
+        inline constexpr auto lightness_order{ make_lch_order<&lch::l>() };
+        inline constexpr auto chroma_order{ make_lch_order<&lch::c>() };
+        inline constexpr auto hue_order{ make_lch_order<&lch::h>() };
+
+        //   The keys in index order, so the binary searches only touch one contiguous array.
+        inline constexpr auto sorted_lightness{ make_sorted_keys<&lch::l>( lightness_order ) };
+        inline constexpr auto sorted_chroma{ make_sorted_keys<&lch::c>( chroma_order ) };
+        inline constexpr auto sorted_hue{ make_sorted_keys<&lch::h>( hue_order ) };
+
+        inline id_span key_range( const std::array<double, canonical_count>& keys, const std::array<color_id, canonical_count>& order, double min, double max )
+        {
+            if( !( min <= max ) )
+            {
+                return {};
+            }
+            const auto first{ std::lower_bound( keys.begin(), keys.end(), min ) };
+            const auto last{ std::upper_bound( first, keys.end(), max ) };
+            return { order.data() + ( first - keys.begin() ), order.data() + ( last - keys.begin() ) };
+        }
+    }
+
+
+
+    inline id_span lightness_range( double min, double max )
+    {
+        return detail::key_range( detail::sorted_lightness, detail::lightness_order, min, max );
+    }
+
+    inline id_span chroma_range( double min, double max )
+    {
+        return detail::key_range( detail::sorted_chroma, detail::chroma_order, min, max );
+    }
+
+    struct hue_spans
+    {
+        id_span first;
+        id_span second;     //  Only used when the range wraps around 0 degrees.
+
+        constexpr std::size_t size() const { return first.size() + second.size(); }
+    };
+
+    //   Hues from from to to, going up.  If from is greater than to the range wraps around through 0 degrees, e.g.
+    // hue_range( 330, 30 ) for reds.
+    inline hue_spans hue_range( double from, double to )
+    {
+        if( from <= to )
+        {
+            return { detail::key_range( detail::sorted_hue, detail::hue_order, from, to ), {} };
+        }
+        return {
+            detail::key_range( detail::sorted_hue, detail::hue_order, from, 360.0 ),
+            detail::key_range( detail::sorted_hue, detail::hue_order, 0.0, to ) };
+    }
+
+    //   Inclusive bounds on all three keys.  The defaults include every color.
+    struct lch_box
+    {
+        double l_min{ 0.0 };
+        double l_max{ 100.0 };
+        double c_min{ 0.0 };
+        double c_max{ 1000.0 };
+        double h_from{ 0.0 };
+        double h_to{ 360.0 };
+    };
+
+    constexpr bool contains( const lch_box& box, const lch& color )
+    {
+        const bool hue{ box.h_from <= box.h_to ? box.h_from <= color.h && color.h <= box.h_to
+                                               : box.h_from <= color.h || color.h <= box.h_to };
+        return hue && box.l_min <= color.l && color.l <= box.l_max && box.c_min <= color.c && color.c <= box.c_max;
+    }
+
+    //   Calls visit( id ) for every named color inside box.  Colors are visited in the order of whichever index
+    // gave the fewest candidates.
+    template<typename Visit>
+    void for_each_in_box( const lch_box& box, Visit visit )
+    {
+        const auto lightness{ lightness_range( box.l_min, box.l_max ) };
+        const auto chroma{ chroma_range( box.c_min, box.c_max ) };
+        const auto hue{ hue_range( box.h_from, box.h_to ) };
+        NAMED_COLORS_COUNT( box_queries, 1 );
+
+        const auto visit_span{ [&box, &visit]( id_span candidates )
+        {
+            NAMED_COLORS_COUNT( box_candidates, candidates.size() );
+            for( const auto id : candidates )
+            {
+                if( contains( box, lch_table[id] ) )
+                {
+                    NAMED_COLORS_COUNT( box_matches, 1 );
+                    visit( id );
+                }
+            }
+        } };
+
+        if( hue.size() <= lightness.size() && hue.size() <= chroma.size() )
+        {
+            visit_span( hue.first );
+            visit_span( hue.second );
+        }
+        else
+        {
+            visit_span( lightness.size() <= chroma.size() ? lightness : chroma );
+        }
+    }
+
+    inline std::size_t count_in_box( const lch_box& box )
+    {
+        std::size_t count{ 0 };
+        for_each_in_box( box, [&count]( color_id ) { ++count; } );
+        return count;
+    }
+}
@@ -0,0 +1,320 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  A compact form of index images, the color_id per pixel that nearest() and
+// name_image() produce: each row as runs of one id, and the connected regions those runs make up, with each
+// region's area and bounding box and which regions touch it.  Questions such as how much of the image is CRIMSON,
+// how many separate CRIMSON patches there are and what they border are then answered from the regions instead of
+// from the pixels:
+//
+//      const auto map{ named_colors::region_map::encode( ids.data(), width, height ) };
+//      const double share{ double( map.area( named_colors::id_of( hex_color::CRIMSON ) ) ) / map.pixel_count() };
+//
+//   The map is built in one pass over the pixels and can be fed a row at a time, so an image that never exists in
+// memory as a whole (say from name_stream()) can still be encoded:
+//
+//      named_colors::region_map map{ width };
+//      while( ... ) map.add_row( row_ids );
+//      map.finish();
+//
+//   Each new row's runs are matched against the runs of the row above in a single merge-like walk, and runs of the
+// same id that overlap are joined with a union-find kept in the runs themselves.  Regions are 4-connected: pixels
+// of the same id that only touch at a corner are separate regions, and neither are they neighbours.
+//
+//   Regions are numbered in the order their first pixel appears in raster order.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<array>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<utility>
+#include<vector>
+
+
+
+namespace named_colors
+{
+    struct index_run
+    {
+        uint32_t x;
+        uint32_t length;
+        color_id id;
+        uint32_t region;        //  Index into region_map::regions(), once finished.
+    };
+
+    struct color_region
+    {
+        color_id id;
+        uint64_t area;
+        uint32_t left;          //  Bounding box, inclusive.
+        uint32_t top;
+        uint32_t right;
+        uint32_t bottom;
+    };
+
+    struct run_span
+    {
+        const index_run* first{ nullptr };
+        const index_run* last{ nullptr };
+
+        const index_run* begin() const  { return first; }
+        const index_run* end() const    { return last; }
+        std::size_t size() const        { return static_cast<std::size_t>( last - first ); }
+        bool empty() const              { return first == last; }
+        const index_run& operator[]( std::size_t i ) const { return first[i]; }
+    };
+
+    struct region_span
+    {
+        const uint32_t* first{ nullptr };
+        const uint32_t* last{ nullptr };
+
+        const uint32_t* begin() const   { return first; }
+        const uint32_t* end() const     { return last; }
+        std::size_t size() const        { return static_cast<std::size_t>( last - first ); }
+        bool empty() const              { return first == last; }
+        uint32_t operator[]( std::size_t i ) const { return first[i]; }
+    };
+
+    class region_map
+    {
+    public:
+        explicit region_map( uint32_t width )
+            : width_( width )
+        {
+        }
+
+        static region_map encode( const color_id* ids, uint32_t width, uint32_t height )
+        {
+            region_map map{ width };
+            for( uint32_t y{ 0 }; y < height; ++y )
+            {
+                map.add_row( ids + std::size_t{ y } * width );
+            }
+            map.finish();
+            return map;
+        }
+
+        //   Appends a row of width ids.  Rows can't be added after finish().
+        void add_row( const color_id* ids )
+        {
+            assert( !finished_ );
+            const auto first{ static_cast<uint32_t>( runs_.size() ) };
+            for( uint32_t x{ 0 }; x < width_; )
+            {
+                const color_id id{ ids[x] };
+                uint32_t end{ x + 1 };
+                while( end < width_ && ids[end] == id )
+                {
+                    ++end;
+                }
+
+                //   Until finish(), region is the run's parent in the union-find, always a run no later than itself.
+                const auto run{ static_cast<uint32_t>( runs_.size() ) };
+                runs_.push_back( { x, end - x, id, run } );
+                if( id < color_count )
+                {
+                    areas_[id] += end - x;
+                }
+                if( run > first )
+                {
+                    edges_.push_back( { run - 1, run } );
+                }
+                x = end;
+            }
+
+            //   Both rows are sorted by x, so one walk over the two finds every pair of runs that share an edge.
+            if( height_ > 0 )
+            {
+                uint32_t above{ row_offsets_[height_ - 1] };
+                uint32_t below{ first };
+                const auto above_end{ first };
+                const auto below_end{ static_cast<uint32_t>( runs_.size() ) };
+                while( above < above_end && below < below_end )
+                {
+                    const auto& a{ runs_[above] };
+                    const auto& b{ runs_[below] };
+                    if( a.id == b.id )
+                    {
+                        unite( above, below );
+                    }
+                    else
+                    {
+                        edges_.push_back( { above, below } );
+                    }
+                    const uint32_t a_end{ a.x + a.length };
+                    const uint32_t b_end{ b.x + b.length };
+                    above += a_end <= b_end;
+                    below += b_end <= a_end;
+                }
+            }
+
+            row_offsets_.push_back( static_cast<uint32_t>( runs_.size() ) );
+            ++height_;
+        }
+
+        //   Numbers the regions and works out their areas, bounding boxes and neighbours.  Only the first call does
+        // anything: afterwards the runs hold region numbers, not union-find parents.
+        void finish()
+        {
+            if( finished_ )
+            {
+                return;
+            }
+            finished_ = true;
+
+            //   Parents always come first, so in one forward pass every parent already points at its root.
+            std::vector<uint32_t> region_of( runs_.size() );
+            regions_.clear();
+            region_counts_.fill( 0 );
+            for( uint32_t y{ 0 }; y < height_; ++y )
+            {
+                for( uint32_t i{ row_offsets_[y] }; i < row_offsets_[y + 1]; ++i )
+                {
+                    auto& run{ runs_[i] };
+                    const uint32_t root{ runs_[run.region].region };
+                    if( root == i )
+                    {
+                        region_of[i] = static_cast<uint32_t>( regions_.size() );
+                        regions_.push_back( { run.id, 0, run.x, y, run.x + run.length - 1, y } );
+                        if( run.id < color_count )
+                        {
+                            ++region_counts_[run.id];
+                        }
+                    }
+                    else
+                    {
+                        region_of[i] = region_of[root];
+                    }
+                    run.region = root;
+
+                    auto& region{ regions_[region_of[i]] };
+                    region.area += run.length;
+                    region.left = std::min( region.left, run.x );
+                    region.right = std::max( region.right, run.x + run.length - 1 );
+                    region.bottom = y;
+                }
+            }
+            for( std::size_t i{ 0 }; i < runs_.size(); ++i )
+            {
+                runs_[i].region = region_of[i];
+            }
+
+            //   Edges between runs become edges between regions, each stored in both directions.
+            std::vector<std::pair<uint32_t, uint32_t>> pairs;
+            pairs.reserve( edges_.size() * 2 );
+            for( const auto& [a, b] : edges_ )
+            {
+                const uint32_t ra{ region_of[a] };
+                const uint32_t rb{ region_of[b] };
+                pairs.push_back( { ra, rb } );
+                pairs.push_back( { rb, ra } );
+            }
+            std::sort( pairs.begin(), pairs.end() );
+            pairs.erase( std::unique( pairs.begin(), pairs.end() ), pairs.end() );
+            neighbour_offsets_.assign( regions_.size() + 1, 0 );
+            neighbours_.clear();
+            neighbours_.reserve( pairs.size() );
+            for( const auto& [from, to] : pairs )
+            {
+                ++neighbour_offsets_[from + 1];
+                neighbours_.push_back( to );
+            }
+            for( std::size_t i{ 1 }; i < neighbour_offsets_.size(); ++i )
+            {
+                neighbour_offsets_[i] += neighbour_offsets_[i - 1];
+            }
+            edges_.clear();
+            edges_.shrink_to_fit();
+        }
+
+        uint32_t width() const                  { return width_; }
+        uint32_t height() const                 { return height_; }
+        uint64_t pixel_count() const            { return uint64_t{ width_ } * height_; }
+        std::size_t run_count() const           { return runs_.size(); }
+
+        //   Pixels of id, and how many separate regions of it there are.  The area is known before finish().
+        uint64_t area( color_id id ) const              { return id < color_count ? areas_[id] : 0; }
+        std::size_t region_count( color_id id ) const   { return id < color_count ? region_counts_[id] : 0; }
+
+        run_span row( uint32_t y ) const
+        {
+            return { runs_.data() + row_offsets_[y], runs_.data() + row_offsets_[y + 1] };
+        }
+
+        const std::vector<color_region>& regions() const { return regions_; }
+
+        //   Regions that share an edge with region, in increasing order.
+        region_span neighbours( uint32_t region ) const
+        {
+            return { neighbours_.data() + neighbour_offsets_[region], neighbours_.data() + neighbour_offsets_[region + 1] };
+        }
+
+        //   The run covering pixel x of row y.  Rows of a zero width map have no runs, so there it's a run of no_color.
+        const index_run& run_at( uint32_t x, uint32_t y ) const
+        {
+            static constexpr index_run none{ 0, 0, no_color, 0 };
+            const auto r{ row( y ) };
+            if( r.empty() )
+            {
+                return none;
+            }
+            return *( std::upper_bound( r.begin(), r.end(), x, []( uint32_t value, const index_run& run ) { return value < run.x; } ) - 1 );
+        }
+
+        color_id at( uint32_t x, uint32_t y ) const        { return run_at( x, y ).id; }
+        uint32_t region_at( uint32_t x, uint32_t y ) const { return run_at( x, y ).region; }
+
+        //   Writes the ids of row y, width of them.
+        void decode_row( uint32_t y, color_id* ids ) const
+        {
+            for( const auto& run : row( y ) )
+            {
+                std::fill( ids + run.x, ids + run.x + run.length, run.id );
+            }
+        }
+
+    private:
+        uint32_t find( uint32_t run )
+        {
+            while( runs_[run].region != run )
+            {
+                runs_[run].region = runs_[runs_[run].region].region;
+                run = runs_[run].region;
+            }
+            return run;
+        }
+
+        //   The later root is attached to the earlier one, so a run's parent never comes after it.
+        void unite( uint32_t a, uint32_t b )
+        {
+            const uint32_t ra{ find( a ) };
+            const uint32_t rb{ find( b ) };
+            if( ra != rb )
+            {
+                runs_[std::max( ra, rb )].region = std::min( ra, rb );
+            }
+        }
+
+        uint32_t                                    width_;
+        uint32_t                                    height_{ 0 };
+        bool                                        finished_{ false };
+        std::vector<index_run>                      runs_;
+        std::vector<uint32_t>                       row_offsets_{ 0 };
+        std::vector<std::pair<uint32_t, uint32_t>>  edges_;         //  Runs that touch and have different ids.
+        std::array<uint64_t, color_count>           areas_{};
+        std::array<uint32_t, color_count>           region_counts_{};
+        std::vector<color_region>                   regions_;
+        std::vector<uint32_t>                       neighbour_offsets_;
+        std::vector<uint32_t>                       neighbours_;
+    };
+}
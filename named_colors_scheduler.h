@@ -0,0 +1,309 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Batch versions of nearest(), palette::quantize() and a histogram of nearest
+// named colors, for many images at once, run on a work stealing scheduler:
+//
+//      named_colors::work_stealing_scheduler scheduler;
+//      std::vector<named_colors::image_span> images{ { pixels_a.data(), pixels_a.size() }, ... };
+//      std::vector<named_colors::color_id*> ids{ ids_a.data(), ... };
+//      named_colors::nearest( scheduler, images.data(), images.size(), ids.data() );
+//
+//   Every image is cut into tiles of at most tile_pixels pixels, so a thumbnail is one task and a large scan is
+// many.  The tiles are dealt out in order to per-thread deques; each thread works through its own from the back
+// and, once it runs dry, steals from the front of the others.  Batches of thousands of small images keep every
+// thread busy without a thread per image, and a single large image still spreads over all of them.  The calling
+// thread works on the batch too.
+//
+//   The pixels are 0xRRGGBBAA, the same as hex_color values.  Results are the same as the single threaded calls.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_palette.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<condition_variable>
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
+#include<deque>
+#include<memory>
+#include<mutex>
+#include<thread>
+#include<type_traits>
+#include<vector>
+
+
+
+namespace named_colors
+{
+    //   One image's pixels, or any other run of colors.
+    struct image_span
+    {
+        const uint32_t* colors;
+        std::size_t     count;
+    };
+
+    class work_stealing_scheduler
+    {
+    public:
+        //   threads includes the caller of run(), so 1 runs everything on the caller.  0 is one per core.
+        explicit work_stealing_scheduler( std::size_t threads = 0, std::size_t tile_pixels = 4096 )
+            : tile_pixels_( std::max<std::size_t>( 1, tile_pixels ) )
+        {
+            const std::size_t count{ threads > 0 ? threads : std::max( 1u, std::thread::hardware_concurrency() ) };
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                queues_.push_back( std::make_unique<queue>() );
+            }
+            for( std::size_t i{ 1 }; i < count; ++i )
+            {
+                threads_.emplace_back( [this, i] { serve( i ); } );
+            }
+        }
+
+        work_stealing_scheduler( const work_stealing_scheduler& ) = delete;
+        work_stealing_scheduler& operator=( const work_stealing_scheduler& ) = delete;
+
+        ~work_stealing_scheduler()
+        {
+            {
+                std::lock_guard lock{ mutex_ };
+                stopping_ = true;
+            }
+            start_.notify_all();
+            for( auto& thread : threads_ )
+            {
+                thread.join();
+            }
+        }
+
+        std::size_t size() const            { return queues_.size(); }
+        std::size_t tile_pixels() const     { return tile_pixels_; }
+
+        //   Tasks taken from another thread's deque since the scheduler was created.
+        std::size_t steals() const
+        {
+            std::lock_guard lock{ mutex_ };
+            return steals_;
+        }
+
+        //   Calls tile( image, first, count, thread ) for every tile of the images and returns once all have
+        // returned.  thread is below size() and no two tiles run on the same thread at once, so it can index
+        // per-thread scratch space.  One batch runs at a time.
+        template<typename Tile>
+        void run( const image_span* images, std::size_t image_count, Tile&& tile )
+        {
+            std::lock_guard batch{ batch_mutex_ };
+
+            tiles_.clear();
+            for( std::size_t i{ 0 }; i < image_count; ++i )
+            {
+                for( std::size_t first{ 0 }; first < images[i].count; first += tile_pixels_ )
+                {
+                    tiles_.push_back( { i, first, std::min( tile_pixels_, images[i].count - first ) } );
+                }
+            }
+            if( tiles_.empty() )
+            {
+                return;
+            }
+
+            //   Neighbouring tiles go to the same thread, so each starts on its own stretch of the batch.
+            const std::size_t threads{ queues_.size() };
+            for( std::size_t t{ 0 }; t < threads; ++t )
+            {
+                auto& q{ *queues_[t] };
+                std::lock_guard lock{ q.mutex };
+                for( std::size_t i{ tiles_.size() * t / threads }; i < tiles_.size() * ( t + 1 ) / threads; ++i )
+                {
+                    q.tasks.push_back( i );
+                }
+            }
+
+            {
+                std::lock_guard lock{ mutex_ };
+                context_ = &tile;
+                call_ = []( void* context, const task& t, std::size_t thread )
+                {
+                    ( *static_cast<std::remove_reference_t<Tile>*>( context ) )( t.image, t.first, t.count, thread );
+                };
+                busy_ = threads_.size();
+                ++generation_;
+            }
+            start_.notify_all();
+
+            work( 0 );
+
+            std::unique_lock lock{ mutex_ };
+            done_.wait( lock, [this] { return busy_ == 0; } );
+            context_ = nullptr;
+        }
+
+    private:
+        struct task
+        {
+            std::size_t image;
+            std::size_t first;
+            std::size_t count;
+        };
+
+        struct queue
+        {
+            std::mutex              mutex;
+            std::deque<std::size_t> tasks;      //  Indices into tiles_.
+        };
+
+        void serve( std::size_t thread )
+        {
+            std::size_t seen{ 0 };
+            for( ;; )
+            {
+                {
+                    std::unique_lock lock{ mutex_ };
+                    start_.wait( lock, [this, seen] { return stopping_ || generation_ != seen; } );
+                    if( stopping_ )
+                    {
+                        return;
+                    }
+                    seen = generation_;
+                }
+                work( thread );
+                {
+                    std::lock_guard lock{ mutex_ };
+                    --busy_;
+                }
+                done_.notify_one();
+            }
+        }
+
+        //   Runs tasks until every deque is empty.
+        void work( std::size_t thread )
+        {
+            const std::size_t threads{ queues_.size() };
+            std::size_t stolen{ 0 };
+            for( ;; )
+            {
+                std::size_t index{ 0 };
+                bool found{ pop_back( *queues_[thread], index ) };
+                for( std::size_t i{ 1 }; i < threads && !found; ++i )
+                {
+                    found = pop_front( *queues_[( thread + i ) % threads], index );
+                    stolen += found;
+                }
+                if( !found )
+                {
+                    break;
+                }
+                call_( context_, tiles_[index], thread );
+                NAMED_COLORS_COUNT( scheduler_tiles, 1 );
+            }
+            NAMED_COLORS_COUNT( scheduler_steals, stolen );
+            if( stolen > 0 )
+            {
+                std::lock_guard lock{ mutex_ };
+                steals_ += stolen;
+            }
+        }
+
+        static bool pop_back( queue& q, std::size_t& index )
+        {
+            std::lock_guard lock{ q.mutex };
+            if( q.tasks.empty() )
+            {
+                return false;
+            }
+            index = q.tasks.back();
+            q.tasks.pop_back();
+            return true;
+        }
+
+        static bool pop_front( queue& q, std::size_t& index )
+        {
+            std::lock_guard lock{ q.mutex };
+            if( q.tasks.empty() )
+            {
+                return false;
+            }
+            index = q.tasks.front();
+            q.tasks.pop_front();
+            return true;
+        }
+
+        std::size_t                         tile_pixels_;
+        std::vector<std::unique_ptr<queue>> queues_;
+        std::vector<task>                   tiles_;
+        void*                               context_{ nullptr };
+        void                              ( *call_ )( void*, const task&, std::size_t ){ nullptr };
+
+        std::mutex                          batch_mutex_;
+        mutable std::mutex                  mutex_;
+        std::condition_variable             start_;
+        std::condition_variable             done_;
+        std::size_t                         generation_{ 0 };
+        std::size_t                         busy_{ 0 };
+        std::size_t                         steals_{ 0 };
+        bool                                stopping_{ false };
+        std::vector<std::thread>            threads_;
+    };
+
+
+
+    //   Writes ids[i][j], the nearest named color of images[i].colors[j], for every image.
+    inline void nearest( work_stealing_scheduler& scheduler, const image_span* images, std::size_t count, color_id* const* ids )
+    {
+        scheduler.run( images, count, [images, ids]( std::size_t image, std::size_t first, std::size_t n, std::size_t )
+        {
+            nearest( images[image].colors + first, n, ids[image] + first );
+        } );
+    }
+
+    //   Writes indices[i][j], the index of the closest color of p to images[i].colors[j], for every image.
+    template<std::size_t N>
+    void quantize( work_stealing_scheduler& scheduler, const palette<N>& p, const image_span* images, std::size_t count,
+                   typename palette<N>::index_type* const* indices )
+    {
+        scheduler.run( images, count, [&p, images, indices]( std::size_t image, std::size_t first, std::size_t n, std::size_t )
+        {
+            p.quantize( images[image].colors + first, n, indices[image] + first );
+        } );
+    }
+
+    //   Sets counts[i][id] to how many pixels of images[i] have id as their nearest named color.  Each counts[i]
+    // has color_count entries.
+    inline void histogram( work_stealing_scheduler& scheduler, const image_span* images, std::size_t count, uint32_t* const* counts )
+    {
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            std::fill( counts[i], counts[i] + color_count, 0u );
+        }
+
+        //   Tiles of one image can run on several threads at once.  Each counts into its thread's scratch array,
+        // then adds the ids it saw to the image's counts under that image's lock.
+        std::vector<std::mutex> locks( count );
+        std::vector<uint32_t> scratch( scheduler.size() * color_count );
+        std::vector<color_id> tile_ids( scheduler.size() * scheduler.tile_pixels() );
+        scheduler.run( images, count, [&]( std::size_t image, std::size_t first, std::size_t n, std::size_t thread )
+        {
+            color_id* ids{ tile_ids.data() + thread * scheduler.tile_pixels() };
+            uint32_t* local{ scratch.data() + thread * color_count };
+            nearest( images[image].colors + first, n, ids );
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                ++local[ids[i]];
+            }
+
+            std::lock_guard lock{ locks[image] };
+            for( std::size_t i{ 0 }; i < n; ++i )
+            {
+                counts[image][ids[i]] += local[ids[i]];
+                local[ids[i]] = 0;
+            }
+        } );
+    }
+}
@@ -0,0 +1,423 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Names the pixels of images too large to load whole: reads a PPM, PAM or raw
+// RGBA8 stream a chunk of rows at a time, finds each pixel's nearest named color on a pool of threads, and writes
+// the index image of named_colors_image.h as each chunk is done:
+//
+//      std::FILE* in{ std::fopen( "scan.ppm", "rb" ) };
+//      std::FILE* out{ std::fopen( "scan_ids.pam", "wb" ) };
+//      named_colors::name_stream( in, out, { .rows_per_chunk = 128, .queue_depth = 4 } );
+//
+//   Each chunk is a coroutine that hops between three executors: a reader thread, the naming threads and a
+// writer thread.  While one chunk is being named the next is being read and the previous written, so I/O
+// overlaps compute.  At most queue_depth chunks are in flight; when the writer falls behind no more are read,
+// so memory stays at queue_depth chunk buffers however large the image is.  Chunks are read and written in
+// order, and the output is the same as name_image() produces.
+//
+//   Requires C++20.
+//
+
+
+
+#include "named_colors_image.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<atomic>
+#include<condition_variable>
+#include<coroutine>
+#include<cstddef>
+#include<cstdint>
+#include<cstdio>
+#include<deque>
+#include<exception>
+#include<functional>
+#include<mutex>
+#include<string>
+#include<thread>
+#include<utility>
+#include<vector>
+
+
+
+namespace named_colors
+{
+    struct stream_options
+    {
+        std::size_t rows_per_chunk{ 256 };
+        std::size_t queue_depth{ 4 };       //  Chunks in flight, each holding its pixels and ids.
+        std::size_t threads{ 0 };           //  Naming threads, or 0 for one per core.
+        std::size_t raw_width{ 0 };         //  If not 0, the input is headerless RGBA8 of raw_width x raw_height.
+        std::size_t raw_height{ 0 };
+    };
+
+    namespace detail
+    {
+        //   A coroutine nobody waits for.  It runs until its first suspension when called and frees itself when
+        // it finishes.
+        struct detached_task
+        {
+            struct promise_type
+            {
+                detached_task get_return_object() noexcept   { return {}; }
+                std::suspend_never initial_suspend() noexcept { return {}; }
+                std::suspend_never final_suspend() noexcept   { return {}; }
+                void return_void() noexcept                  {}
+                void unhandled_exception() noexcept          { std::terminate(); }
+            };
+        };
+
+        class thread_pool
+        {
+        public:
+            explicit thread_pool( std::size_t threads )
+            {
+                for( std::size_t i{ 0 }; i < threads; ++i )
+                {
+                    threads_.emplace_back( [this] { work(); } );
+                }
+            }
+
+            thread_pool( const thread_pool& ) = delete;
+            thread_pool& operator=( const thread_pool& ) = delete;
+
+            ~thread_pool()
+            {
+                join();
+            }
+
+            //   Runs what has been posted, then stops the threads.
+            void join()
+            {
+                {
+                    std::lock_guard lock{ mutex_ };
+                    stopping_ = true;
+                }
+                ready_.notify_all();
+                for( auto& thread : threads_ )
+                {
+                    if( thread.joinable() )
+                    {
+                        thread.join();
+                    }
+                }
+            }
+
+            std::size_t size() const { return threads_.size(); }
+
+            void post( std::function<void()> job )
+            {
+                {
+                    std::lock_guard lock{ mutex_ };
+                    jobs_.push_back( std::move( job ) );
+                }
+                ready_.notify_one();
+            }
+
+            //   co_await pool.schedule() continues the coroutine on one of the pool's threads.
+            auto schedule()
+            {
+                struct awaiter
+                {
+                    thread_pool* pool;
+
+                    bool await_ready() const noexcept                { return false; }
+                    void await_suspend( std::coroutine_handle<> h ) { pool->post( h ); }
+                    void await_resume() const noexcept               {}
+                };
+                return awaiter{ this };
+            }
+
+            //   co_await pool.parallel_for( n, f ) calls f( 0 ) ... f( n - 1 ) on the pool's threads and continues
+            // once all of them have returned, on the thread that ran the last one.
+            template<typename F>
+            auto parallel_for( std::size_t count, F f )
+            {
+                struct awaiter
+                {
+                    thread_pool*             pool;
+                    std::size_t              count;
+                    F                        f;
+                    std::atomic<std::size_t> remaining;
+                    std::coroutine_handle<>  continuation;
+
+                    bool await_ready() const noexcept { return count == 0; }
+
+                    void await_suspend( std::coroutine_handle<> h )
+                    {
+                        continuation = h;
+                        remaining = count;
+
+                        //   The last job resumes the coroutine, which may destroy this awaiter before the loop ends,
+                        // so the loop only uses copies.
+                        auto* const self{ this };
+                        auto* const target{ pool };
+                        const std::size_t n{ count };
+                        for( std::size_t i{ 0 }; i < n; ++i )
+                        {
+                            target->post( [self, i]
+                            {
+                                self->f( i );
+                                if( --self->remaining == 0 )
+                                {
+                                    self->continuation.resume();
+                                }
+                            } );
+                        }
+                    }
+
+                    void await_resume() const noexcept {}
+                };
+                return awaiter{ this, count, std::move( f ), {}, {} };
+            }
+
+        private:
+            void work()
+            {
+                for( ;; )
+                {
+                    std::function<void()> job;
+                    {
+                        std::unique_lock lock{ mutex_ };
+                        ready_.wait( lock, [this] { return stopping_ || !jobs_.empty(); } );
+                        if( jobs_.empty() )
+                        {
+                            return;
+                        }
+                        job = std::move( jobs_.front() );
+                        jobs_.pop_front();
+                    }
+                    job();
+                }
+            }
+
+            std::mutex                        mutex_;
+            std::condition_variable           ready_;
+            std::deque<std::function<void()>> jobs_;
+            bool                              stopping_{ false };
+            std::vector<std::thread>          threads_;
+        };
+
+        //   Lets coroutines take turns in order: co_await wait( n ) continues once advance() has been called n times.
+        class sequencer
+        {
+        public:
+            explicit sequencer( thread_pool& pool ) : pool_( pool ) {}
+
+            auto wait( std::size_t turn )
+            {
+                struct awaiter
+                {
+                    sequencer*  owner;
+                    std::size_t turn;
+
+                    bool await_ready() const noexcept { return false; }
+
+                    bool await_suspend( std::coroutine_handle<> h )
+                    {
+                        std::lock_guard lock{ owner->mutex_ };
+                        if( owner->next_ == turn )
+                        {
+                            return false;
+                        }
+                        owner->waiting_.emplace_back( turn, h );
+                        return true;
+                    }
+
+                    void await_resume() const noexcept {}
+                };
+                return awaiter{ this, turn };
+            }
+
+            //   Ends the current turn.  Whoever is waiting for the next one continues on the pool.
+            void advance()
+            {
+                std::coroutine_handle<> next;
+                {
+                    std::lock_guard lock{ mutex_ };
+                    ++next_;
+                    const auto waiter{ std::find_if( waiting_.begin(), waiting_.end(), [this]( const auto& w ) { return w.first == next_; } ) };
+                    if( waiter != waiting_.end() )
+                    {
+                        next = waiter->second;
+                        waiting_.erase( waiter );
+                    }
+                }
+                if( next )
+                {
+                    pool_.post( next );
+                }
+            }
+
+        private:
+            thread_pool&                                             pool_;
+            std::mutex                                               mutex_;
+            std::size_t                                              next_{ 0 };
+            std::vector<std::pair<std::size_t, std::coroutine_handle<>>> waiting_;
+        };
+
+        //   Reads a PPM or PAM header from the start of a stream, a byte at a time so none of the pixels are consumed.
+        inline bool read_header( std::FILE* in, std::size_t& width, std::size_t& height, std::size_t& channels )
+        {
+            std::string text;
+            for( int c{ std::fgetc( in ) }; c != EOF && text.size() < 65536; c = std::fgetc( in ) )
+            {
+                text.push_back( static_cast<char>( c ) );
+                if( header_reader::is_space( static_cast<uint8_t>( c ) ) )
+                {
+                    const auto* first{ reinterpret_cast<const uint8_t*>( text.data() ) };
+                    header_reader header{ first, first + text.size() };
+                    if( read_header( header, width, height, channels ) && header.next + 1 == header.last )
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        class stream_pipeline
+        {
+        public:
+            stream_pipeline( std::FILE* in, std::FILE* out, std::size_t width, std::size_t height, std::size_t channels,
+                             const stream_options& options )
+                : in_( in ), out_( out ), width_( width ), height_( height ), channels_( channels ),
+                  rows_( std::max<std::size_t>( 1, options.rows_per_chunk ) ),
+                  depth_( std::max<std::size_t>( 1, options.queue_depth ) ),
+                  slots_( depth_ ),
+                  naming_( options.threads > 0 ? options.threads : std::max( 1u, std::thread::hardware_concurrency() ) )
+            {
+                for( auto& slot : slots_ )
+                {
+                    slot.pixels.resize( rows_ * width_ * channels_ );
+                    slot.ids.resize( rows_ * width_ );
+                }
+            }
+
+            stream_pipeline( const stream_pipeline& ) = delete;
+            stream_pipeline& operator=( const stream_pipeline& ) = delete;
+
+            //   The pools' threads post to each other, so all of them have to stop before any pool is destroyed.
+            ~stream_pipeline()
+            {
+                reader_.join();
+                writer_.join();
+                naming_.join();
+            }
+
+            bool run()
+            {
+                const std::size_t chunks{ ( height_ + rows_ - 1 ) / rows_ };
+                for( std::size_t chunk{ 0 }; chunk < chunks; ++chunk )
+                {
+                    {
+                        std::unique_lock lock{ mutex_ };
+                        slot_free_.wait( lock, [this] { return in_flight_ < depth_; } );
+                        ++in_flight_;
+                    }
+                    process( chunk );
+                }
+                std::unique_lock lock{ mutex_ };
+                slot_free_.wait( lock, [this] { return in_flight_ == 0; } );
+                return !failed_;
+            }
+
+        private:
+            struct slot
+            {
+                std::vector<uint8_t>  pixels;
+                std::vector<color_id> ids;
+            };
+
+            detached_task process( std::size_t chunk )
+            {
+                //   Chunks finish in order, so the oldest chunk's slot is the one that was freed.
+                auto& s{ slots_[chunk % depth_] };
+                const std::size_t rows{ std::min( rows_, height_ - chunk * rows_ ) };
+                const std::size_t count{ rows * width_ };
+
+                //   The reader has one thread and chunks are started in order, so reads happen in order.
+                co_await reader_.schedule();
+                if( !failed_ && std::fread( s.pixels.data(), channels_, count, in_ ) != count )
+                {
+                    failed_ = true;
+                }
+
+                if( !failed_ )
+                {
+                    constexpr std::size_t block{ 1024 };
+                    const std::size_t parts{ std::min( naming_.size(), ( count + block - 1 ) / block ) };
+                    //   Rounded up twice, to a whole share and then to a whole block, so the parts cover count.
+                    const std::size_t per_part{ ( ( count + parts - 1 ) / parts + block - 1 ) / block * block };
+                    co_await naming_.parallel_for( parts, [this, &s, count, per_part]( std::size_t part )
+                    {
+                        const std::size_t first{ std::min( count, part * per_part ) };
+                        const std::size_t n{ std::min( count - first, per_part ) };
+                        nearest( s.pixels.data() + first * channels_, n, channels_, s.ids.data() + first );
+                        to_big_endian( s.ids.data() + first, n );
+                    } );
+                }
+
+                co_await writer_.schedule();
+                co_await written_.wait( chunk );
+                if( !failed_ && std::fwrite( s.ids.data(), sizeof( color_id ), count, out_ ) != count )
+                {
+                    failed_ = true;
+                }
+                written_.advance();
+
+                {
+                    std::lock_guard lock{ mutex_ };
+                    --in_flight_;
+                    slot_free_.notify_all();
+                }
+            }
+
+            std::FILE*              in_;
+            std::FILE*              out_;
+            std::size_t             width_;
+            std::size_t             height_;
+            std::size_t             channels_;
+            std::size_t             rows_;
+            std::size_t             depth_;
+            std::atomic<bool>       failed_{ false };
+            std::mutex              mutex_;
+            std::condition_variable slot_free_;
+            std::size_t             in_flight_{ 0 };
+            std::vector<slot>       slots_;
+
+            thread_pool             reader_{ 1 };
+            thread_pool             writer_{ 1 };
+            thread_pool             naming_;
+            sequencer               written_{ writer_ };
+        };
+    }
+
+    //   Writes the index image of in's nearest named colors to out.  Returns false if in isn't a PPM or PAM
+    // named_colors_image.h can read (or, with raw_width set, is too short) or if either stream fails.  Neither
+    // stream is closed.
+    inline bool name_stream( std::FILE* in, std::FILE* out, const stream_options& options = {} )
+    {
+        std::size_t width{ options.raw_width };
+        std::size_t height{ options.raw_height };
+        std::size_t channels{ 4 };
+        if( width == 0 && !detail::read_header( in, width, height, channels ) )
+        {
+            return false;
+        }
+        if( width == 0 || height == 0 )
+        {
+            return false;
+        }
+
+        const auto header{ detail::index_header( width, height ) };
+        if( std::fwrite( header.data(), 1, header.size(), out ) != header.size() )
+        {
+            return false;
+        }
+        detail::stream_pipeline pipeline{ in, out, width, height, channels, options };
+        return pipeline.run() && std::fflush( out ) == 0;
+    }
+}
@@ -0,0 +1,1528 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Every color defined in hex_color is listed here along with its name, which makes
+// it possible to iterate over the colors and to look them up at run time.
+//
+//   Colors are identified by their position in named_colors::table, called a color_id.  Aliases (AMBER_SAE and
+// AMBER_ECE, CAFÉ_AU_LAIT and CAFE_AU_LAIT, ...) each have their own id but share a value.  Whenever a value has to
+// be turned back into a single id, the alias that comes first in the table wins.  Alpha is ignored by all lookups
+// since every named color is fully opaque.
+// 
+//   Works with or without NAMED_COLORS_PREFER_ENUM and, like named_colors.h, only requires C++17.
+//
+
+
+
+#include "named_colors.h"
+
+#include<array>
+#include<cstddef>
+#include<cstdint>
+#include<string_view>
+
+//   Hot path counters, see named_colors_instrumentation.h.  Without NAMED_COLORS_ENABLE_INSTRUMENTATION they
+// expand to nothing.
+#if defined(NAMED_COLORS_ENABLE_INSTRUMENTATION)
+#   include "named_colors_instrumentation.h"
+#elif !defined(NAMED_COLORS_COUNT)
+#   define NAMED_COLORS_COUNT( name, n )      static_cast<void>( 0 )
+#   define NAMED_COLORS_COUNT_BATCH( size )   static_cast<void>( 0 )
+#endif
+
+
+
+namespace named_colors
+{
+    using color_id = uint16_t;
+
+    //   Returned by the lookups below when there is no match.
+    constexpr color_id no_color{ 0xFF'FF };
+
+    struct entry
+    {
+        std::string_view name;
+        uint32_t         value;
+    };
+
+    inline constexpr std::array<entry, 991> table{ {
+        { "ABSOLUTE_ZERO",                            static_cast<uint32_t>( hex_color::ABSOLUTE_ZERO ) },
+        { "ACID_GREEN",                               static_cast<uint32_t>( hex_color::ACID_GREEN ) },
+        { "AERO",                                     static_cast<uint32_t>( hex_color::AERO ) },
+        { "AERO_BLUE",                                static_cast<uint32_t>( hex_color::AERO_BLUE ) },
+        { "AFRICAN_VIOLET",                           static_cast<uint32_t>( hex_color::AFRICAN_VIOLET ) },
+        { "AIR_SUPERIORITY_BLUE",                     static_cast<uint32_t>( hex_color::AIR_SUPERIORITY_BLUE ) },
+        { "ALABASTER",                                static_cast<uint32_t>( hex_color::ALABASTER ) },
+        { "ALICE_BLUE",                               static_cast<uint32_t>( hex_color::ALICE_BLUE ) },
+        { "ALLOY_ORANGE",                             static_cast<uint32_t>( hex_color::ALLOY_ORANGE ) },
+        { "ALMOND",                                   static_cast<uint32_t>( hex_color::ALMOND ) },
+        { "AMARANTH",                                 static_cast<uint32_t>( hex_color::AMARANTH ) },
+        { "AMARANTH_M_AND_P",                         static_cast<uint32_t>( hex_color::AMARANTH_M_AND_P ) },
+        { "AMARANTH_PINK",                            static_cast<uint32_t>( hex_color::AMARANTH_PINK ) },
+        { "AMARANTH_PURPLE",                          static_cast<uint32_t>( hex_color::AMARANTH_PURPLE ) },
+        { "AMARANTH_RED",                             static_cast<uint32_t>( hex_color::AMARANTH_RED ) },
+        { "AMAZON",                                   static_cast<uint32_t>( hex_color::AMAZON ) },
+        { "AMBER",                                    static_cast<uint32_t>( hex_color::AMBER ) },
+        { "AMBER_SAE",                                static_cast<uint32_t>( hex_color::AMBER_SAE ) },
+        { "AMBER_ECE",                                static_cast<uint32_t>( hex_color::AMBER_ECE ) },
+        { "AMETHYST",                                 static_cast<uint32_t>( hex_color::AMETHYST ) },
+        { "ANDROID_GREEN",                            static_cast<uint32_t>( hex_color::ANDROID_GREEN ) },
+        { "ANTIQUE_BRASS",                            static_cast<uint32_t>( hex_color::ANTIQUE_BRASS ) },
+        { "ANTIQUE_BRONZE",                           static_cast<uint32_t>( hex_color::ANTIQUE_BRONZE ) },
+        { "ANTIQUE_FUCHSIA",                          static_cast<uint32_t>( hex_color::ANTIQUE_FUCHSIA ) },
+        { "ANTIQUE_RUBY",                             static_cast<uint32_t>( hex_color::ANTIQUE_RUBY ) },
+        { "ANTIQUE_WHITE",                            static_cast<uint32_t>( hex_color::ANTIQUE_WHITE ) },
+        { "AO",                                       static_cast<uint32_t>( hex_color::AO ) },
+        { "APPLE_GREEN",                              static_cast<uint32_t>( hex_color::APPLE_GREEN ) },
+        { "APRICOT",                                  static_cast<uint32_t>( hex_color::APRICOT ) },
+        { "AQUA",                                     static_cast<uint32_t>( hex_color::AQUA ) },
+        { "AQUAMARINE",                               static_cast<uint32_t>( hex_color::AQUAMARINE ) },
+        { "ARCTIC_LIME",                              static_cast<uint32_t>( hex_color::ARCTIC_LIME ) },
+        { "ARMY_GREEN",                               static_cast<uint32_t>( hex_color::ARMY_GREEN ) },
+        { "ARTICHOKE",                                static_cast<uint32_t>( hex_color::ARTICHOKE ) },
+        { "ARYLIDE_YELLOW",                           static_cast<uint32_t>( hex_color::ARYLIDE_YELLOW ) },
+        { "ASH_GRAY",                                 static_cast<uint32_t>( hex_color::ASH_GRAY ) },
+        { "ASPARAGUS",                                static_cast<uint32_t>( hex_color::ASPARAGUS ) },
+        { "ATOMIC_TANGERINE",                         static_cast<uint32_t>( hex_color::ATOMIC_TANGERINE ) },
+        { "AUBURN",                                   static_cast<uint32_t>( hex_color::AUBURN ) },
+        { "AUREOLIN",                                 static_cast<uint32_t>( hex_color::AUREOLIN ) },
+        { "AVOCADO",                                  static_cast<uint32_t>( hex_color::AVOCADO ) },
+        { "AZURE",                                    static_cast<uint32_t>( hex_color::AZURE ) },
+        { "AZURE_X11",                                static_cast<uint32_t>( hex_color::AZURE_X11 ) },
+        { "AZURE_WEB",                                static_cast<uint32_t>( hex_color::AZURE_WEB ) },
+        { "BABY_BLUE",                                static_cast<uint32_t>( hex_color::BABY_BLUE ) },
+        { "BABY_BLUE_EYES",                           static_cast<uint32_t>( hex_color::BABY_BLUE_EYES ) },
+        { "BABY_PINK",                                static_cast<uint32_t>( hex_color::BABY_PINK ) },
+        { "BABY_POWDER",                              static_cast<uint32_t>( hex_color::BABY_POWDER ) },
+        { "BAKER_MILLER_PINK",                        static_cast<uint32_t>( hex_color::BAKER_MILLER_PINK ) },
+        { "BANANA_MANIA",                             static_cast<uint32_t>( hex_color::BANANA_MANIA ) },
+        { "BARBIE_PINK",                              static_cast<uint32_t>( hex_color::BARBIE_PINK ) },
+        { "BARN_RED",                                 static_cast<uint32_t>( hex_color::BARN_RED ) },
+        { "BATTLESHIP_GREY",                          static_cast<uint32_t>( hex_color::BATTLESHIP_GREY ) },
+        { "BEAU_BLUE",                                static_cast<uint32_t>( hex_color::BEAU_BLUE ) },
+        { "BEAVER",                                   static_cast<uint32_t>( hex_color::BEAVER ) },
+        { "BEIGE",                                    static_cast<uint32_t>( hex_color::BEIGE ) },
+        { "B_DAZZLED_BLUE",                           static_cast<uint32_t>( hex_color::B_DAZZLED_BLUE ) },
+        { "BIG_DIP_O_RUBY",                           static_cast<uint32_t>( hex_color::BIG_DIP_O_RUBY ) },
+        { "BISQUE",                                   static_cast<uint32_t>( hex_color::BISQUE ) },
+        { "BISTRE",                                   static_cast<uint32_t>( hex_color::BISTRE ) },
+        { "BISTRE_BROWN",                             static_cast<uint32_t>( hex_color::BISTRE_BROWN ) },
+        { "BITTER_LEMON",                             static_cast<uint32_t>( hex_color::BITTER_LEMON ) },
+        { "BITTER_LIME",                              static_cast<uint32_t>( hex_color::BITTER_LIME ) },
+        { "BITTERSWEET",                              static_cast<uint32_t>( hex_color::BITTERSWEET ) },
+        { "BITTERSWEET_SHIMMER",                      static_cast<uint32_t>( hex_color::BITTERSWEET_SHIMMER ) },
+        { "BLACK",                                    static_cast<uint32_t>( hex_color::BLACK ) },
+        { "BLACK_BEAN",                               static_cast<uint32_t>( hex_color::BLACK_BEAN ) },
+        { "BLACK_CHOCOLATE",                          static_cast<uint32_t>( hex_color::BLACK_CHOCOLATE ) },
+        { "BLACK_COFFEE",                             static_cast<uint32_t>( hex_color::BLACK_COFFEE ) },
+        { "BLACK_CORAL",                              static_cast<uint32_t>( hex_color::BLACK_CORAL ) },
+        { "BLACK_OLIVE",                              static_cast<uint32_t>( hex_color::BLACK_OLIVE ) },
+        { "BLACK_SHADOWS",                            static_cast<uint32_t>( hex_color::BLACK_SHADOWS ) },
+        { "BLANCHED_ALMOND",                          static_cast<uint32_t>( hex_color::BLANCHED_ALMOND ) },
+        { "BLAST_OFF_BRONZE",                         static_cast<uint32_t>( hex_color::BLAST_OFF_BRONZE ) },
+        { "BLEU_DE_FRANCE",                           static_cast<uint32_t>( hex_color::BLEU_DE_FRANCE ) },
+        { "BLIZZARD_BLUE",                            static_cast<uint32_t>( hex_color::BLIZZARD_BLUE ) },
+        { "BLOND",                                    static_cast<uint32_t>( hex_color::BLOND ) },
+        { "BLOOD_RED",                                static_cast<uint32_t>( hex_color::BLOOD_RED ) },
+        { "BLUE",                                     static_cast<uint32_t>( hex_color::BLUE ) },
+        { "BLUE_CRAYOLA",                             static_cast<uint32_t>( hex_color::BLUE_CRAYOLA ) },
+        { "BLUE_MUNSELL",                             static_cast<uint32_t>( hex_color::BLUE_MUNSELL ) },
+        { "BLUE_NCS",                                 static_cast<uint32_t>( hex_color::BLUE_NCS ) },
+        { "BLUE_PANTONE",                             static_cast<uint32_t>( hex_color::BLUE_PANTONE ) },
+        { "BLUE_PIGMENT",                             static_cast<uint32_t>( hex_color::BLUE_PIGMENT ) },
+        { "BLUE_RYB",                                 static_cast<uint32_t>( hex_color::BLUE_RYB ) },
+        { "BLUE_BELL",                                static_cast<uint32_t>( hex_color::BLUE_BELL ) },
+        { "BLUE_GRAY",                                static_cast<uint32_t>( hex_color::BLUE_GRAY ) },
+        { "BLUE_GREEN",                               static_cast<uint32_t>( hex_color::BLUE_GREEN ) },
+        { "BLUE_GREEN_COLOR_WHEEL",                   static_cast<uint32_t>( hex_color::BLUE_GREEN_COLOR_WHEEL ) },
+        { "BLUE_JEANS",                               static_cast<uint32_t>( hex_color::BLUE_JEANS ) },
+        { "BLUE_SAPPHIRE",                            static_cast<uint32_t>( hex_color::BLUE_SAPPHIRE ) },
+        { "BLUE_VIOLET",                              static_cast<uint32_t>( hex_color::BLUE_VIOLET ) },
+        { "BLUE_VIOLET_CRAYOLA",                      static_cast<uint32_t>( hex_color::BLUE_VIOLET_CRAYOLA ) },
+        { "BLUE_VIOLET_COLOR_WHEEL",                  static_cast<uint32_t>( hex_color::BLUE_VIOLET_COLOR_WHEEL ) },
+        { "BLUE_YONDER",                              static_cast<uint32_t>( hex_color::BLUE_YONDER ) },
+        { "BLUETIFUL",                                static_cast<uint32_t>( hex_color::BLUETIFUL ) },
+        { "BLUSH",                                    static_cast<uint32_t>( hex_color::BLUSH ) },
+        { "BOLE",                                     static_cast<uint32_t>( hex_color::BOLE ) },
+        { "BONE",                                     static_cast<uint32_t>( hex_color::BONE ) },
+        { "BOTTLE_GREEN",                             static_cast<uint32_t>( hex_color::BOTTLE_GREEN ) },
+        { "BRANDY",                                   static_cast<uint32_t>( hex_color::BRANDY ) },
+        { "BRICK_RED",                                static_cast<uint32_t>( hex_color::BRICK_RED ) },
+        { "BRIGHT_GREEN",                             static_cast<uint32_t>( hex_color::BRIGHT_GREEN ) },
+        { "BRIGHT_LILAC",                             static_cast<uint32_t>( hex_color::BRIGHT_LILAC ) },
+        { "BRIGHT_MAROON",                            static_cast<uint32_t>( hex_color::BRIGHT_MAROON ) },
+        { "BRIGHT_NAVY_BLUE",                         static_cast<uint32_t>( hex_color::BRIGHT_NAVY_BLUE ) },
+        { "BRIGHT_YELLOW_CRAYOLA",                    static_cast<uint32_t>( hex_color::BRIGHT_YELLOW_CRAYOLA ) },
+        { "BRILLIANT_ROSE",                           static_cast<uint32_t>( hex_color::BRILLIANT_ROSE ) },
+        { "BRINK_PINK",                               static_cast<uint32_t>( hex_color::BRINK_PINK ) },
+        { "BRITISH_RACING_GREEN",                     static_cast<uint32_t>( hex_color::BRITISH_RACING_GREEN ) },
+        { "BRONZE",                                   static_cast<uint32_t>( hex_color::BRONZE ) },
+        { "BROWN",                                    static_cast<uint32_t>( hex_color::BROWN ) },
+        { "BROWN_SUGAR",                              static_cast<uint32_t>( hex_color::BROWN_SUGAR ) },
+        { "BRUNSWICK_GREEN",                          static_cast<uint32_t>( hex_color::BRUNSWICK_GREEN ) },
+        { "BUD_GREEN",                                static_cast<uint32_t>( hex_color::BUD_GREEN ) },
+        { "BUFF",                                     static_cast<uint32_t>( hex_color::BUFF ) },
+        { "BURGUNDY",                                 static_cast<uint32_t>( hex_color::BURGUNDY ) },
+        { "BURLYWOOD",                                static_cast<uint32_t>( hex_color::BURLYWOOD ) },
+        { "BURNISHED_BROWN",                          static_cast<uint32_t>( hex_color::BURNISHED_BROWN ) },
+        { "BURNT_ORANGE",                             static_cast<uint32_t>( hex_color::BURNT_ORANGE ) },
+        { "BURNT_SIENNA",                             static_cast<uint32_t>( hex_color::BURNT_SIENNA ) },
+        { "BURNT_UMBER",                              static_cast<uint32_t>( hex_color::BURNT_UMBER ) },
+        { "BYZANTINE",                                static_cast<uint32_t>( hex_color::BYZANTINE ) },
+        { "BYZANTIUM",                                static_cast<uint32_t>( hex_color::BYZANTIUM ) },
+        { "CADET",                                    static_cast<uint32_t>( hex_color::CADET ) },
+        { "CADET_BLUE",                               static_cast<uint32_t>( hex_color::CADET_BLUE ) },
+        { "CADET_BLUE_CRAYOLA",                       static_cast<uint32_t>( hex_color::CADET_BLUE_CRAYOLA ) },
+        { "CADET_GREY",                               static_cast<uint32_t>( hex_color::CADET_GREY ) },
+        { "CADMIUM_GREEN",                            static_cast<uint32_t>( hex_color::CADMIUM_GREEN ) },
+        { "CADMIUM_ORANGE",                           static_cast<uint32_t>( hex_color::CADMIUM_ORANGE ) },
+        { "CADMIUM_RED",                              static_cast<uint32_t>( hex_color::CADMIUM_RED ) },
+        { "CADMIUM_YELLOW",                           static_cast<uint32_t>( hex_color::CADMIUM_YELLOW ) },
+        { "CAFÉ_AU_LAIT",                             static_cast<uint32_t>( hex_color::CAFÉ_AU_LAIT ) },
+        { "CAFE_AU_LAIT",                             static_cast<uint32_t>( hex_color::CAFE_AU_LAIT ) },
+        { "CAFÉ_NOIR",                                static_cast<uint32_t>( hex_color::CAFÉ_NOIR ) },
+        { "CAFE_NOIR",                                static_cast<uint32_t>( hex_color::CAFE_NOIR ) },
+        { "CAMBRIDGE_BLUE",                           static_cast<uint32_t>( hex_color::CAMBRIDGE_BLUE ) },
+        { "CAMEL",                                    static_cast<uint32_t>( hex_color::CAMEL ) },
+        { "CAMEO_PINK",                               static_cast<uint32_t>( hex_color::CAMEO_PINK ) },
+        { "CANARY",                                   static_cast<uint32_t>( hex_color::CANARY ) },
+        { "CANARY_YELLOW",                            static_cast<uint32_t>( hex_color::CANARY_YELLOW ) },
+        { "CANDY_APPLE_RED",                          static_cast<uint32_t>( hex_color::CANDY_APPLE_RED ) },
+        { "CANDY_PINK",                               static_cast<uint32_t>( hex_color::CANDY_PINK ) },
+        { "CAPRI",                                    static_cast<uint32_t>( hex_color::CAPRI ) },
+        { "CAPUT_MORTUUM",                            static_cast<uint32_t>( hex_color::CAPUT_MORTUUM ) },
+        { "CARDINAL",                                 static_cast<uint32_t>( hex_color::CARDINAL ) },
+        { "CARIBBEAN_GREEN",                          static_cast<uint32_t>( hex_color::CARIBBEAN_GREEN ) },
+        { "CARMINE",                                  static_cast<uint32_t>( hex_color::CARMINE ) },
+        { "CARMINE_M_AND_P",                          static_cast<uint32_t>( hex_color::CARMINE_M_AND_P ) },
+        { "CARNATION_PINK",                           static_cast<uint32_t>( hex_color::CARNATION_PINK ) },
+        { "CARNELIAN",                                static_cast<uint32_t>( hex_color::CARNELIAN ) },
+        { "CAROLINA_BLUE",                            static_cast<uint32_t>( hex_color::CAROLINA_BLUE ) },
+        { "CARROT_ORANGE",                            static_cast<uint32_t>( hex_color::CARROT_ORANGE ) },
+        { "CASTLETON_GREEN",                          static_cast<uint32_t>( hex_color::CASTLETON_GREEN ) },
+        { "CATAWBA",                                  static_cast<uint32_t>( hex_color::CATAWBA ) },
+        { "CEDAR_CHEST",                              static_cast<uint32_t>( hex_color::CEDAR_CHEST ) },
+        { "CELADON",                                  static_cast<uint32_t>( hex_color::CELADON ) },
+        { "CELADON_BLUE",                             static_cast<uint32_t>( hex_color::CELADON_BLUE ) },
+        { "CELADON_GREEN",                            static_cast<uint32_t>( hex_color::CELADON_GREEN ) },
+        { "CELESTE",                                  static_cast<uint32_t>( hex_color::CELESTE ) },
+        { "CELTIC_BLUE",                              static_cast<uint32_t>( hex_color::CELTIC_BLUE ) },
+        { "CERISE",                                   static_cast<uint32_t>( hex_color::CERISE ) },
+        { "CERULEAN",                                 static_cast<uint32_t>( hex_color::CERULEAN ) },
+        { "CERULEAN_BLUE",                            static_cast<uint32_t>( hex_color::CERULEAN_BLUE ) },
+        { "CERULEAN_FROST",                           static_cast<uint32_t>( hex_color::CERULEAN_FROST ) },
+        { "CERULEAN_CRAYOLA",                         static_cast<uint32_t>( hex_color::CERULEAN_CRAYOLA ) },
+        { "CG_BLUE",                                  static_cast<uint32_t>( hex_color::CG_BLUE ) },
+        { "CG_RED",                                   static_cast<uint32_t>( hex_color::CG_RED ) },
+        { "CHAMPAGN",                                 static_cast<uint32_t>( hex_color::CHAMPAGN ) },
+        { "CHAMPAGNE_PINK",                           static_cast<uint32_t>( hex_color::CHAMPAGNE_PINK ) },
+        { "CHARCOAL",                                 static_cast<uint32_t>( hex_color::CHARCOAL ) },
+        { "CHARLESTON_GREEN",                         static_cast<uint32_t>( hex_color::CHARLESTON_GREEN ) },
+        { "CHARM_PINK",                               static_cast<uint32_t>( hex_color::CHARM_PINK ) },
+        { "CHARTREUSE_TRADITIONAL",                   static_cast<uint32_t>( hex_color::CHARTREUSE_TRADITIONAL ) },
+        { "CHARTREUSE_WEB",                           static_cast<uint32_t>( hex_color::CHARTREUSE_WEB ) },
+        { "CHERRY_BLOSSOM_PINK",                      static_cast<uint32_t>( hex_color::CHERRY_BLOSSOM_PINK ) },
+        { "CHESTNUT",                                 static_cast<uint32_t>( hex_color::CHESTNUT ) },
+        { "CHILI_RED",                                static_cast<uint32_t>( hex_color::CHILI_RED ) },
+        { "CHINA_PINK",                               static_cast<uint32_t>( hex_color::CHINA_PINK ) },
+        { "CHINA_ROSE",                               static_cast<uint32_t>( hex_color::CHINA_ROSE ) },
+        { "CHINESE_RED",                              static_cast<uint32_t>( hex_color::CHINESE_RED ) },
+        { "CHINESE_VIOLET",                           static_cast<uint32_t>( hex_color::CHINESE_VIOLET ) },
+        { "CHINESE_YELLOW",                           static_cast<uint32_t>( hex_color::CHINESE_YELLOW ) },
+        { "CHOCOLATE_TRADITIONAL",                    static_cast<uint32_t>( hex_color::CHOCOLATE_TRADITIONAL ) },
+        { "CHOCOLATE_WEB",                            static_cast<uint32_t>( hex_color::CHOCOLATE_WEB ) },
+        { "CHOCOLATE_COSMOS",                         static_cast<uint32_t>( hex_color::CHOCOLATE_COSMOS ) },
+        { "CHROME_YELLOW",                            static_cast<uint32_t>( hex_color::CHROME_YELLOW ) },
+        { "CINEREOUS",                                static_cast<uint32_t>( hex_color::CINEREOUS ) },
+        { "CINNABAR",                                 static_cast<uint32_t>( hex_color::CINNABAR ) },
+        { "CINNAMON_SATIN",                           static_cast<uint32_t>( hex_color::CINNAMON_SATIN ) },
+        { "CITRINE",                                  static_cast<uint32_t>( hex_color::CITRINE ) },
+        { "CITRON",                                   static_cast<uint32_t>( hex_color::CITRON ) },
+        { "CLARET",                                   static_cast<uint32_t>( hex_color::CLARET ) },
+        { "COBALT_BLUE",                              static_cast<uint32_t>( hex_color::COBALT_BLUE ) },
+        { "COCOA_BROWN",                              static_cast<uint32_t>( hex_color::COCOA_BROWN ) },
+        { "COFFEE",                                   static_cast<uint32_t>( hex_color::COFFEE ) },
+        { "COLUMBIA_BLUE",                            static_cast<uint32_t>( hex_color::COLUMBIA_BLUE ) },
+        { "CONGO_PINK",                               static_cast<uint32_t>( hex_color::CONGO_PINK ) },
+        { "COOL_GREY",                                static_cast<uint32_t>( hex_color::COOL_GREY ) },
+        { "COPPER",                                   static_cast<uint32_t>( hex_color::COPPER ) },
+        { "COPPER_CRAYOLA",                           static_cast<uint32_t>( hex_color::COPPER_CRAYOLA ) },
+        { "COPPER_PENNY",                             static_cast<uint32_t>( hex_color::COPPER_PENNY ) },
+        { "COPPER_RED",                               static_cast<uint32_t>( hex_color::COPPER_RED ) },
+        { "COPPER_ROSE",                              static_cast<uint32_t>( hex_color::COPPER_ROSE ) },
+        { "COQUELICOT",                               static_cast<uint32_t>( hex_color::COQUELICOT ) },
+        { "CORAL",                                    static_cast<uint32_t>( hex_color::CORAL ) },
+        { "CORAL_PINK",                               static_cast<uint32_t>( hex_color::CORAL_PINK ) },
+        { "CORDOVAN",                                 static_cast<uint32_t>( hex_color::CORDOVAN ) },
+        { "CORN",                                     static_cast<uint32_t>( hex_color::CORN ) },
+        { "CORNELL_RED",                              static_cast<uint32_t>( hex_color::CORNELL_RED ) },
+        { "CORNFLOWER_BLUE",                          static_cast<uint32_t>( hex_color::CORNFLOWER_BLUE ) },
+        { "CORNSILK",                                 static_cast<uint32_t>( hex_color::CORNSILK ) },
+        { "COSMIC_COBALT",                            static_cast<uint32_t>( hex_color::COSMIC_COBALT ) },
+        { "COSMIC_LATTE",                             static_cast<uint32_t>( hex_color::COSMIC_LATTE ) },
+        { "COYOTE_BROWN",                             static_cast<uint32_t>( hex_color::COYOTE_BROWN ) },
+        { "COTTON_CANDY",                             static_cast<uint32_t>( hex_color::COTTON_CANDY ) },
+        { "CREAM",                                    static_cast<uint32_t>( hex_color::CREAM ) },
+        { "CRIMSON",                                  static_cast<uint32_t>( hex_color::CRIMSON ) },
+        { "CRIMSON_UA",                               static_cast<uint32_t>( hex_color::CRIMSON_UA ) },
+        { "CRYSTAL",                                  static_cast<uint32_t>( hex_color::CRYSTAL ) },
+        { "CULTURED",                                 static_cast<uint32_t>( hex_color::CULTURED ) },
+        { "CYAN",                                     static_cast<uint32_t>( hex_color::CYAN ) },
+        { "CYAN_PROCESS",                             static_cast<uint32_t>( hex_color::CYAN_PROCESS ) },
+        { "CYBER_GRAPE",                              static_cast<uint32_t>( hex_color::CYBER_GRAPE ) },
+        { "CYBER_YELLOW",                             static_cast<uint32_t>( hex_color::CYBER_YELLOW ) },
+        { "CYCLAMEN",                                 static_cast<uint32_t>( hex_color::CYCLAMEN ) },
+        { "DARK_BLUE_GRAY",                           static_cast<uint32_t>( hex_color::DARK_BLUE_GRAY ) },
+        { "DARK_BROWN",                               static_cast<uint32_t>( hex_color::DARK_BROWN ) },
+        { "DARK_BYZANTIUM",                           static_cast<uint32_t>( hex_color::DARK_BYZANTIUM ) },
+        { "DARK_CORNFLOWER_BLUE",                     static_cast<uint32_t>( hex_color::DARK_CORNFLOWER_BLUE ) },
+        { "DARK_CYAN",                                static_cast<uint32_t>( hex_color::DARK_CYAN ) },
+        { "DARK_ELECTRIC_BLUE",                       static_cast<uint32_t>( hex_color::DARK_ELECTRIC_BLUE ) },
+        { "DARK_GOLDENROD",                           static_cast<uint32_t>( hex_color::DARK_GOLDENROD ) },
+        { "DARK_GREEN",                               static_cast<uint32_t>( hex_color::DARK_GREEN ) },
+        { "DARK_GREEN_X11",                           static_cast<uint32_t>( hex_color::DARK_GREEN_X11 ) },
+        { "DARK_JUNGLE_GREEN",                        static_cast<uint32_t>( hex_color::DARK_JUNGLE_GREEN ) },
+        { "DARK_KHAKI",                               static_cast<uint32_t>( hex_color::DARK_KHAKI ) },
+        { "DARK_LAVA",                                static_cast<uint32_t>( hex_color::DARK_LAVA ) },
+        { "DARK_LIVER",                               static_cast<uint32_t>( hex_color::DARK_LIVER ) },
+        { "DARK_LIVER_HORSES",                        static_cast<uint32_t>( hex_color::DARK_LIVER_HORSES ) },
+        { "DARK_MAGENTA",                             static_cast<uint32_t>( hex_color::DARK_MAGENTA ) },
+        { "DARK_MOSS_GREEN",                          static_cast<uint32_t>( hex_color::DARK_MOSS_GREEN ) },
+        { "DARK_OLIVE_GREEN",                         static_cast<uint32_t>( hex_color::DARK_OLIVE_GREEN ) },
+        { "DARK_ORANGE",                              static_cast<uint32_t>( hex_color::DARK_ORANGE ) },
+        { "DARK_ORCHID",                              static_cast<uint32_t>( hex_color::DARK_ORCHID ) },
+        { "DARK_PASTEL_GREEN",                        static_cast<uint32_t>( hex_color::DARK_PASTEL_GREEN ) },
+        { "DARK_PURPLE",                              static_cast<uint32_t>( hex_color::DARK_PURPLE ) },
+        { "DARK_RED",                                 static_cast<uint32_t>( hex_color::DARK_RED ) },
+        { "DARK_SALMON",                              static_cast<uint32_t>( hex_color::DARK_SALMON ) },
+        { "DARK_SEA_GREEN",                           static_cast<uint32_t>( hex_color::DARK_SEA_GREEN ) },
+        { "DARK_SIENNA",                              static_cast<uint32_t>( hex_color::DARK_SIENNA ) },
+        { "DARK_SKY_BLUE",                            static_cast<uint32_t>( hex_color::DARK_SKY_BLUE ) },
+        { "DARK_SLATE_BLUE",                          static_cast<uint32_t>( hex_color::DARK_SLATE_BLUE ) },
+        { "DARK_SLATE_GRAY",                          static_cast<uint32_t>( hex_color::DARK_SLATE_GRAY ) },
+        { "DARK_SPRING_GREEN",                        static_cast<uint32_t>( hex_color::DARK_SPRING_GREEN ) },
+        { "DARK_TURQUOISE",                           static_cast<uint32_t>( hex_color::DARK_TURQUOISE ) },
+        { "DARK_VIOLET",                              static_cast<uint32_t>( hex_color::DARK_VIOLET ) },
+        { "DARTMOUTH_GREEN",                          static_cast<uint32_t>( hex_color::DARTMOUTH_GREEN ) },
+        { "DAVYS_GREY",                               static_cast<uint32_t>( hex_color::DAVYS_GREY ) },
+        { "DEEP_CERISE",                              static_cast<uint32_t>( hex_color::DEEP_CERISE ) },
+        { "DEEP_CHAMPAGNE",                           static_cast<uint32_t>( hex_color::DEEP_CHAMPAGNE ) },
+        { "DEEP_CHESTNUT",                            static_cast<uint32_t>( hex_color::DEEP_CHESTNUT ) },
+        { "DEEP_JUNGLE_GREEN",                        static_cast<uint32_t>( hex_color::DEEP_JUNGLE_GREEN ) },
+        { "DEEP_PINK",                                static_cast<uint32_t>( hex_color::DEEP_PINK ) },
+        { "DEEP_SAFFRON",                             static_cast<uint32_t>( hex_color::DEEP_SAFFRON ) },
+        { "DEEP_SKY_BLUE",                            static_cast<uint32_t>( hex_color::DEEP_SKY_BLUE ) },
+        { "DEEP_SPACE_SPARKLE",                       static_cast<uint32_t>( hex_color::DEEP_SPACE_SPARKLE ) },
+        { "DEEP_TAUPE",                               static_cast<uint32_t>( hex_color::DEEP_TAUPE ) },
+        { "DENIM",                                    static_cast<uint32_t>( hex_color::DENIM ) },
+        { "DENIM_BLUE",                               static_cast<uint32_t>( hex_color::DENIM_BLUE ) },
+        { "DESERT",                                   static_cast<uint32_t>( hex_color::DESERT ) },
+        { "DESERT_SAND",                              static_cast<uint32_t>( hex_color::DESERT_SAND ) },
+        { "DIM_GRAY",                                 static_cast<uint32_t>( hex_color::DIM_GRAY ) },
+        { "DODGER_BLUE",                              static_cast<uint32_t>( hex_color::DODGER_BLUE ) },
+        { "DOGWOOD_ROSE",                             static_cast<uint32_t>( hex_color::DOGWOOD_ROSE ) },
+        { "DRAB",                                     static_cast<uint32_t>( hex_color::DRAB ) },
+        { "DUKE_BLUE",                                static_cast<uint32_t>( hex_color::DUKE_BLUE ) },
+        { "DUTCH_WHITE",                              static_cast<uint32_t>( hex_color::DUTCH_WHITE ) },
+        { "EARTH_YELLOW",                             static_cast<uint32_t>( hex_color::EARTH_YELLOW ) },
+        { "EBONY",                                    static_cast<uint32_t>( hex_color::EBONY ) },
+        { "ECRU",                                     static_cast<uint32_t>( hex_color::ECRU ) },
+        { "EERIE_BLACK",                              static_cast<uint32_t>( hex_color::EERIE_BLACK ) },
+        { "EGGPLANT",                                 static_cast<uint32_t>( hex_color::EGGPLANT ) },
+        { "EGGSHELL",                                 static_cast<uint32_t>( hex_color::EGGSHELL ) },
+        { "EGYPTIAN_BLUE",                            static_cast<uint32_t>( hex_color::EGYPTIAN_BLUE ) },
+        { "EIGENGRAU",                                static_cast<uint32_t>( hex_color::EIGENGRAU ) },
+        { "ELECTRIC_BLUE",                            static_cast<uint32_t>( hex_color::ELECTRIC_BLUE ) },
+        { "ELECTRIC_GREEN",                           static_cast<uint32_t>( hex_color::ELECTRIC_GREEN ) },
+        { "ELECTRIC_INDIGO",                          static_cast<uint32_t>( hex_color::ELECTRIC_INDIGO ) },
+        { "ELECTRIC_LIME",                            static_cast<uint32_t>( hex_color::ELECTRIC_LIME ) },
+        { "ELECTRIC_PURPLE",                          static_cast<uint32_t>( hex_color::ELECTRIC_PURPLE ) },
+        { "ELECTRIC_VIOLET",                          static_cast<uint32_t>( hex_color::ELECTRIC_VIOLET ) },
+        { "EMERALD",                                  static_cast<uint32_t>( hex_color::EMERALD ) },
+        { "EMINENCE",                                 static_cast<uint32_t>( hex_color::EMINENCE ) },
+        { "ENGLISH_GREEN",                            static_cast<uint32_t>( hex_color::ENGLISH_GREEN ) },
+        { "ENGLISH_LAVENDER",                         static_cast<uint32_t>( hex_color::ENGLISH_LAVENDER ) },
+        { "ENGLISH_RED",                              static_cast<uint32_t>( hex_color::ENGLISH_RED ) },
+        { "ENGLISH_VERMILLION",                       static_cast<uint32_t>( hex_color::ENGLISH_VERMILLION ) },
+        { "ENGLISH_VIOLET",                           static_cast<uint32_t>( hex_color::ENGLISH_VIOLET ) },
+        { "ERIN",                                     static_cast<uint32_t>( hex_color::ERIN ) },
+        { "ETON_BLUE",                                static_cast<uint32_t>( hex_color::ETON_BLUE ) },
+        { "FALLOW",                                   static_cast<uint32_t>( hex_color::FALLOW ) },
+        { "FALU_RED",                                 static_cast<uint32_t>( hex_color::FALU_RED ) },
+        { "FANDANGO",                                 static_cast<uint32_t>( hex_color::FANDANGO ) },
+        { "FANDANGO_PINK",                            static_cast<uint32_t>( hex_color::FANDANGO_PINK ) },
+        { "FASHION_FUCHSIA",                          static_cast<uint32_t>( hex_color::FASHION_FUCHSIA ) },
+        { "FAWN",                                     static_cast<uint32_t>( hex_color::FAWN ) },
+        { "FELDGRAU",                                 static_cast<uint32_t>( hex_color::FELDGRAU ) },
+        { "FERN_GREEN",                               static_cast<uint32_t>( hex_color::FERN_GREEN ) },
+        { "FIELD_DRAB",                               static_cast<uint32_t>( hex_color::FIELD_DRAB ) },
+        { "FIERY_ROSE",                               static_cast<uint32_t>( hex_color::FIERY_ROSE ) },
+        { "FIREBRICK",                                static_cast<uint32_t>( hex_color::FIREBRICK ) },
+        { "FIRE_ENGINE_RED",                          static_cast<uint32_t>( hex_color::FIRE_ENGINE_RED ) },
+        { "FIRE_OPAL",                                static_cast<uint32_t>( hex_color::FIRE_OPAL ) },
+        { "FLAME",                                    static_cast<uint32_t>( hex_color::FLAME ) },
+        { "FLAX",                                     static_cast<uint32_t>( hex_color::FLAX ) },
+        { "FLIRT",                                    static_cast<uint32_t>( hex_color::FLIRT ) },
+        { "FLORAL_WHITE",                             static_cast<uint32_t>( hex_color::FLORAL_WHITE ) },
+        { "FLUORESCENT_BLUE",                         static_cast<uint32_t>( hex_color::FLUORESCENT_BLUE ) },
+        { "FOREST_GREEN_CRAYOLA",                     static_cast<uint32_t>( hex_color::FOREST_GREEN_CRAYOLA ) },
+        { "FOREST_GREEN_TRADITIONAL",                 static_cast<uint32_t>( hex_color::FOREST_GREEN_TRADITIONAL ) },
+        { "FOREST_GREEN_WEB",                         static_cast<uint32_t>( hex_color::FOREST_GREEN_WEB ) },
+        { "FRENCH_BEIGE",                             static_cast<uint32_t>( hex_color::FRENCH_BEIGE ) },
+        { "FRENCH_BISTRE",                            static_cast<uint32_t>( hex_color::FRENCH_BISTRE ) },
+        { "FRENCH_BLUE",                              static_cast<uint32_t>( hex_color::FRENCH_BLUE ) },
+        { "FRENCH_FUCHSIA",                           static_cast<uint32_t>( hex_color::FRENCH_FUCHSIA ) },
+        { "FRENCH_LILAC",                             static_cast<uint32_t>( hex_color::FRENCH_LILAC ) },
+        { "FRENCH_LIME",                              static_cast<uint32_t>( hex_color::FRENCH_LIME ) },
+        { "FRENCH_MAUVE",                             static_cast<uint32_t>( hex_color::FRENCH_MAUVE ) },
+        { "FRENCH_PINK",                              static_cast<uint32_t>( hex_color::FRENCH_PINK ) },
+        { "FRENCH_RASPBERRY",                         static_cast<uint32_t>( hex_color::FRENCH_RASPBERRY ) },
+        { "FRENCH_ROSE",                              static_cast<uint32_t>( hex_color::FRENCH_ROSE ) },
+        { "FRENCH_SKY_BLUE",                          static_cast<uint32_t>( hex_color::FRENCH_SKY_BLUE ) },
+        { "FRENCH_VIOLET",                            static_cast<uint32_t>( hex_color::FRENCH_VIOLET ) },
+        { "FROSTBITE",                                static_cast<uint32_t>( hex_color::FROSTBITE ) },
+        { "FUCHSIA",                                  static_cast<uint32_t>( hex_color::FUCHSIA ) },
+        { "FUCHSIA_CRAYOLA",                          static_cast<uint32_t>( hex_color::FUCHSIA_CRAYOLA ) },
+        { "FUCHSIA_PURPLE",                           static_cast<uint32_t>( hex_color::FUCHSIA_PURPLE ) },
+        { "FUCHSIA_ROSE",                             static_cast<uint32_t>( hex_color::FUCHSIA_ROSE ) },
+        { "FULVOUS",                                  static_cast<uint32_t>( hex_color::FULVOUS ) },
+        { "FUZZY_WUZZY",                              static_cast<uint32_t>( hex_color::FUZZY_WUZZY ) },
+        { "GAINSBORO",                                static_cast<uint32_t>( hex_color::GAINSBORO ) },
+        { "GAMBOGE",                                  static_cast<uint32_t>( hex_color::GAMBOGE ) },
+        { "GENERIC_VIRIDIAN",                         static_cast<uint32_t>( hex_color::GENERIC_VIRIDIAN ) },
+        { "GHOST_WHITE",                              static_cast<uint32_t>( hex_color::GHOST_WHITE ) },
+        { "GLAUCOUS",                                 static_cast<uint32_t>( hex_color::GLAUCOUS ) },
+        { "GLOSSY_GRAPE",                             static_cast<uint32_t>( hex_color::GLOSSY_GRAPE ) },
+        { "GO_GREEN",                                 static_cast<uint32_t>( hex_color::GO_GREEN ) },
+        { "GOLD",                                     static_cast<uint32_t>( hex_color::GOLD ) },
+        { "GOLD_METALLIC",                            static_cast<uint32_t>( hex_color::GOLD_METALLIC ) },
+        { "GOLDEN",                                   static_cast<uint32_t>( hex_color::GOLDEN ) },
+        { "GOLD_WEB",                                 static_cast<uint32_t>( hex_color::GOLD_WEB ) },
+        { "GOLD_CRAYOLA",                             static_cast<uint32_t>( hex_color::GOLD_CRAYOLA ) },
+        { "GOLD_FUSION",                              static_cast<uint32_t>( hex_color::GOLD_FUSION ) },
+        { "GOLDEN_BROWN",                             static_cast<uint32_t>( hex_color::GOLDEN_BROWN ) },
+        { "GOLDEN_POPPY",                             static_cast<uint32_t>( hex_color::GOLDEN_POPPY ) },
+        { "GOLDEN_YELLOW",                            static_cast<uint32_t>( hex_color::GOLDEN_YELLOW ) },
+        { "GOLDENROD",                                static_cast<uint32_t>( hex_color::GOLDENROD ) },
+        { "GOTHAM_GREEN",                             static_cast<uint32_t>( hex_color::GOTHAM_GREEN ) },
+        { "GRANITE_GRAY",                             static_cast<uint32_t>( hex_color::GRANITE_GRAY ) },
+        { "GRANNY_SMITH_APPLE",                       static_cast<uint32_t>( hex_color::GRANNY_SMITH_APPLE ) },
+        { "GRAY",                                     static_cast<uint32_t>( hex_color::GRAY ) },
+        { "GRAY_WEB",                                 static_cast<uint32_t>( hex_color::GRAY_WEB ) },
+        { "GRAY_X11",                                 static_cast<uint32_t>( hex_color::GRAY_X11 ) },
+        { "GREY",                                     static_cast<uint32_t>( hex_color::GREY ) },
+        { "GREEN",                                    static_cast<uint32_t>( hex_color::GREEN ) },
+        { "GREEN_CRAYOLA",                            static_cast<uint32_t>( hex_color::GREEN_CRAYOLA ) },
+        { "GREEN_WEB",                                static_cast<uint32_t>( hex_color::GREEN_WEB ) },
+        { "GREEN_MUNSELL",                            static_cast<uint32_t>( hex_color::GREEN_MUNSELL ) },
+        { "GREEN_NCS",                                static_cast<uint32_t>( hex_color::GREEN_NCS ) },
+        { "GREEN_PANTONE",                            static_cast<uint32_t>( hex_color::GREEN_PANTONE ) },
+        { "GREEN_PIGMENT",                            static_cast<uint32_t>( hex_color::GREEN_PIGMENT ) },
+        { "GREEN_RYB",                                static_cast<uint32_t>( hex_color::GREEN_RYB ) },
+        { "GREEN_BLUE",                               static_cast<uint32_t>( hex_color::GREEN_BLUE ) },
+        { "GREEN_BLUE_CRAYOLA",                       static_cast<uint32_t>( hex_color::GREEN_BLUE_CRAYOLA ) },
+        { "GREEN_CYAN",                               static_cast<uint32_t>( hex_color::GREEN_CYAN ) },
+        { "GREEN_LIZARD",                             static_cast<uint32_t>( hex_color::GREEN_LIZARD ) },
+        { "GREEN_SHEEN",                              static_cast<uint32_t>( hex_color::GREEN_SHEEN ) },
+        { "GREEN_YELLOW",                             static_cast<uint32_t>( hex_color::GREEN_YELLOW ) },
+        { "GREEN_YELLOW_CRAYOLA",                     static_cast<uint32_t>( hex_color::GREEN_YELLOW_CRAYOLA ) },
+        { "GRULLO",                                   static_cast<uint32_t>( hex_color::GRULLO ) },
+        { "GUNMETAL",                                 static_cast<uint32_t>( hex_color::GUNMETAL ) },
+        { "HAN_BLUE",                                 static_cast<uint32_t>( hex_color::HAN_BLUE ) },
+        { "HAN_PURPLE",                               static_cast<uint32_t>( hex_color::HAN_PURPLE ) },
+        { "HANSA_YELLOW",                             static_cast<uint32_t>( hex_color::HANSA_YELLOW ) },
+        { "HARLEQUIN",                                static_cast<uint32_t>( hex_color::HARLEQUIN ) },
+        { "HARVEST_GOLD",                             static_cast<uint32_t>( hex_color::HARVEST_GOLD ) },
+        { "HEAT_WAVE",                                static_cast<uint32_t>( hex_color::HEAT_WAVE ) },
+        { "HELIOTROPE",                               static_cast<uint32_t>( hex_color::HELIOTROPE ) },
+        { "HELIOTROPE_GRAY",                          static_cast<uint32_t>( hex_color::HELIOTROPE_GRAY ) },
+        { "HOLLYWOOD_CERISE",                         static_cast<uint32_t>( hex_color::HOLLYWOOD_CERISE ) },
+        { "HONEYDEW",                                 static_cast<uint32_t>( hex_color::HONEYDEW ) },
+        { "HONOLULU_BLUE",                            static_cast<uint32_t>( hex_color::HONOLULU_BLUE ) },
+        { "HOOKERS_GREEN",                            static_cast<uint32_t>( hex_color::HOOKERS_GREEN ) },
+        { "HOT_MAGENTA",                              static_cast<uint32_t>( hex_color::HOT_MAGENTA ) },
+        { "HOT_PINK",                                 static_cast<uint32_t>( hex_color::HOT_PINK ) },
+        { "HUNTER_GREEN",                             static_cast<uint32_t>( hex_color::HUNTER_GREEN ) },
+        { "ICEBERG",                                  static_cast<uint32_t>( hex_color::ICEBERG ) },
+        { "ICTERINE",                                 static_cast<uint32_t>( hex_color::ICTERINE ) },
+        { "ILLUMINATING_EMERALD",                     static_cast<uint32_t>( hex_color::ILLUMINATING_EMERALD ) },
+        { "IMPERIAL_RED",                             static_cast<uint32_t>( hex_color::IMPERIAL_RED ) },
+        { "INCHWORM",                                 static_cast<uint32_t>( hex_color::INCHWORM ) },
+        { "INDEPENDENCE",                             static_cast<uint32_t>( hex_color::INDEPENDENCE ) },
+        { "INDIA_GREEN",                              static_cast<uint32_t>( hex_color::INDIA_GREEN ) },
+        { "INDIAN_RED",                               static_cast<uint32_t>( hex_color::INDIAN_RED ) },
+        { "INDIAN_YELLOW",                            static_cast<uint32_t>( hex_color::INDIAN_YELLOW ) },
+        { "INDIGO",                                   static_cast<uint32_t>( hex_color::INDIGO ) },
+        { "INDIGO_DYE",                               static_cast<uint32_t>( hex_color::INDIGO_DYE ) },
+        { "INTERNATIONAL_KLEIN_BLUE",                 static_cast<uint32_t>( hex_color::INTERNATIONAL_KLEIN_BLUE ) },
+        { "INTERNATIONAL_ORANGE_AEROSPACE",           static_cast<uint32_t>( hex_color::INTERNATIONAL_ORANGE_AEROSPACE ) },
+        { "INTERNATIONAL_ORANGE_ENGINEERING",         static_cast<uint32_t>( hex_color::INTERNATIONAL_ORANGE_ENGINEERING ) },
+        { "INTERNATIONAL_ORANGE_GOLDEN_GATE_BRIDGE",  static_cast<uint32_t>( hex_color::INTERNATIONAL_ORANGE_GOLDEN_GATE_BRIDGE ) },
+        { "GOLDEN_GATE_BRIDGE_RED",                   static_cast<uint32_t>( hex_color::GOLDEN_GATE_BRIDGE_RED ) },
+        { "IRIS",                                     static_cast<uint32_t>( hex_color::IRIS ) },
+        { "IRRESISTIBLE",                             static_cast<uint32_t>( hex_color::IRRESISTIBLE ) },
+        { "ISABELLINE",                               static_cast<uint32_t>( hex_color::ISABELLINE ) },
+        { "ITALIAN_SKY_BLUE",                         static_cast<uint32_t>( hex_color::ITALIAN_SKY_BLUE ) },
+        { "IVORY",                                    static_cast<uint32_t>( hex_color::IVORY ) },
+        { "JADE",                                     static_cast<uint32_t>( hex_color::JADE ) },
+        { "JAPANESE_CARMINE",                         static_cast<uint32_t>( hex_color::JAPANESE_CARMINE ) },
+        { "JAPANESE_VIOLET",                          static_cast<uint32_t>( hex_color::JAPANESE_VIOLET ) },
+        { "JASMINE",                                  static_cast<uint32_t>( hex_color::JASMINE ) },
+        { "JAZZBERRY_JAM",                            static_cast<uint32_t>( hex_color::JAZZBERRY_JAM ) },
+        { "JET",                                      static_cast<uint32_t>( hex_color::JET ) },
+        { "JONQUIL",                                  static_cast<uint32_t>( hex_color::JONQUIL ) },
+        { "JUNE_BUD",                                 static_cast<uint32_t>( hex_color::JUNE_BUD ) },
+        { "JUNGLE_GREEN",                             static_cast<uint32_t>( hex_color::JUNGLE_GREEN ) },
+        { "KELLY_GREEN",                              static_cast<uint32_t>( hex_color::KELLY_GREEN ) },
+        { "KEPPEL",                                   static_cast<uint32_t>( hex_color::KEPPEL ) },
+        { "KEY_LIME",                                 static_cast<uint32_t>( hex_color::KEY_LIME ) },
+        { "KHAKI_WEB",                                static_cast<uint32_t>( hex_color::KHAKI_WEB ) },
+        { "KHAKI_X11",                                static_cast<uint32_t>( hex_color::KHAKI_X11 ) },
+        { "KOBE",                                     static_cast<uint32_t>( hex_color::KOBE ) },
+        { "KOBI",                                     static_cast<uint32_t>( hex_color::KOBI ) },
+        { "KOBICHA",                                  static_cast<uint32_t>( hex_color::KOBICHA ) },
+        { "KOMBU_GREEN",                              static_cast<uint32_t>( hex_color::KOMBU_GREEN ) },
+        { "KSU_PURPLE",                               static_cast<uint32_t>( hex_color::KSU_PURPLE ) },
+        { "LANGUID_LAVENDER",                         static_cast<uint32_t>( hex_color::LANGUID_LAVENDER ) },
+        { "LAPIS_LAZULI",                             static_cast<uint32_t>( hex_color::LAPIS_LAZULI ) },
+        { "LASER_LEMON",                              static_cast<uint32_t>( hex_color::LASER_LEMON ) },
+        { "LAUREL_GREEN",                             static_cast<uint32_t>( hex_color::LAUREL_GREEN ) },
+        { "LAVA",                                     static_cast<uint32_t>( hex_color::LAVA ) },
+        { "LAVENDER_FLORAL",                          static_cast<uint32_t>( hex_color::LAVENDER_FLORAL ) },
+        { "LAVENDER_WEB",                             static_cast<uint32_t>( hex_color::LAVENDER_WEB ) },
+        { "LAVENDER_BLUE",                            static_cast<uint32_t>( hex_color::LAVENDER_BLUE ) },
+        { "LAVENDER_BLUSH",                           static_cast<uint32_t>( hex_color::LAVENDER_BLUSH ) },
+        { "LAVENDER_GRAY",                            static_cast<uint32_t>( hex_color::LAVENDER_GRAY ) },
+        { "LAWN_GREEN",                               static_cast<uint32_t>( hex_color::LAWN_GREEN ) },
+        { "LEMON",                                    static_cast<uint32_t>( hex_color::LEMON ) },
+        { "LEMON_CHIFFON",                            static_cast<uint32_t>( hex_color::LEMON_CHIFFON ) },
+        { "LEMON_CURRY",                              static_cast<uint32_t>( hex_color::LEMON_CURRY ) },
+        { "LEMON_GLACIER",                            static_cast<uint32_t>( hex_color::LEMON_GLACIER ) },
+        { "LEMON_MERINGUE",                           static_cast<uint32_t>( hex_color::LEMON_MERINGUE ) },
+        { "LEMON_YELLOW",                             static_cast<uint32_t>( hex_color::LEMON_YELLOW ) },
+        { "LEMON_YELLOW_CRAYOLA",                     static_cast<uint32_t>( hex_color::LEMON_YELLOW_CRAYOLA ) },
+        { "LIBERTY",                                  static_cast<uint32_t>( hex_color::LIBERTY ) },
+        { "LIGHT_BLUE",                               static_cast<uint32_t>( hex_color::LIGHT_BLUE ) },
+        { "LIGHT_CORAL",                              static_cast<uint32_t>( hex_color::LIGHT_CORAL ) },
+        { "LIGHT_CORNFLOWER_BLUE",                    static_cast<uint32_t>( hex_color::LIGHT_CORNFLOWER_BLUE ) },
+        { "LIGHT_CYAN",                               static_cast<uint32_t>( hex_color::LIGHT_CYAN ) },
+        { "LIGHT_FRENCH_BEIGE",                       static_cast<uint32_t>( hex_color::LIGHT_FRENCH_BEIGE ) },
+        { "LIGHT_GOLDENROD_YELLOW",                   static_cast<uint32_t>( hex_color::LIGHT_GOLDENROD_YELLOW ) },
+        { "LIGHT_GRAY",                               static_cast<uint32_t>( hex_color::LIGHT_GRAY ) },
+        { "LIGHT_GREEN",                              static_cast<uint32_t>( hex_color::LIGHT_GREEN ) },
+        { "LIGHT_KHAKI",                              static_cast<uint32_t>( hex_color::LIGHT_KHAKI ) },
+        { "LIGHT_ORANGE",                             static_cast<uint32_t>( hex_color::LIGHT_ORANGE ) },
+        { "LIGHT_PERIWINKLE",                         static_cast<uint32_t>( hex_color::LIGHT_PERIWINKLE ) },
+        { "LIGHT_PINK",                               static_cast<uint32_t>( hex_color::LIGHT_PINK ) },
+        { "LIGHT_SALMON",                             static_cast<uint32_t>( hex_color::LIGHT_SALMON ) },
+        { "LIGHT_SEA_GREEN",                          static_cast<uint32_t>( hex_color::LIGHT_SEA_GREEN ) },
+        { "LIGHT_SKY_BLUE",                           static_cast<uint32_t>( hex_color::LIGHT_SKY_BLUE ) },
+        { "LIGHT_SLATE_GRAY",                         static_cast<uint32_t>( hex_color::LIGHT_SLATE_GRAY ) },
+        { "LIGHT_STEEL_BLUE",                         static_cast<uint32_t>( hex_color::LIGHT_STEEL_BLUE ) },
+        { "LIGHT_YELLOW",                             static_cast<uint32_t>( hex_color::LIGHT_YELLOW ) },
+        { "LILAC",                                    static_cast<uint32_t>( hex_color::LILAC ) },
+        { "LILAC_LUSTER",                             static_cast<uint32_t>( hex_color::LILAC_LUSTER ) },
+        { "LIME_COLOR_WHEEL",                         static_cast<uint32_t>( hex_color::LIME_COLOR_WHEEL ) },
+        { "LIME_WEB",                                 static_cast<uint32_t>( hex_color::LIME_WEB ) },
+        { "LIME_X11",                                 static_cast<uint32_t>( hex_color::LIME_X11 ) },
+        { "LIME_GREEN",                               static_cast<uint32_t>( hex_color::LIME_GREEN ) },
+        { "LINCOLN_GREEN",                            static_cast<uint32_t>( hex_color::LINCOLN_GREEN ) },
+        { "LINEN",                                    static_cast<uint32_t>( hex_color::LINEN ) },
+        { "LION",                                     static_cast<uint32_t>( hex_color::LION ) },
+        { "LISERAN_PURPLE",                           static_cast<uint32_t>( hex_color::LISERAN_PURPLE ) },
+        { "LITTLE_BOY_BLUE",                          static_cast<uint32_t>( hex_color::LITTLE_BOY_BLUE ) },
+        { "LIVER",                                    static_cast<uint32_t>( hex_color::LIVER ) },
+        { "LIVER_DOGS",                               static_cast<uint32_t>( hex_color::LIVER_DOGS ) },
+        { "LIVER_ORGAN",                              static_cast<uint32_t>( hex_color::LIVER_ORGAN ) },
+        { "LIVER_CHESTNUT",                           static_cast<uint32_t>( hex_color::LIVER_CHESTNUT ) },
+        { "LIVID",                                    static_cast<uint32_t>( hex_color::LIVID ) },
+        { "MACARONI_AND_CHEESE",                      static_cast<uint32_t>( hex_color::MACARONI_AND_CHEESE ) },
+        { "MADDER_LAKE",                              static_cast<uint32_t>( hex_color::MADDER_LAKE ) },
+        { "MAGENTA",                                  static_cast<uint32_t>( hex_color::MAGENTA ) },
+        { "MAGENTA_CRAYOLA",                          static_cast<uint32_t>( hex_color::MAGENTA_CRAYOLA ) },
+        { "MAGENTA_DYE",                              static_cast<uint32_t>( hex_color::MAGENTA_DYE ) },
+        { "MAGENTA_PANTONE",                          static_cast<uint32_t>( hex_color::MAGENTA_PANTONE ) },
+        { "MAGENTA_PROCESS",                          static_cast<uint32_t>( hex_color::MAGENTA_PROCESS ) },
+        { "MAGENTA_HAZE",                             static_cast<uint32_t>( hex_color::MAGENTA_HAZE ) },
+        { "MAGIC_MINT",                               static_cast<uint32_t>( hex_color::MAGIC_MINT ) },
+        { "MAGNOLIA",                                 static_cast<uint32_t>( hex_color::MAGNOLIA ) },
+        { "MAHOGANY",                                 static_cast<uint32_t>( hex_color::MAHOGANY ) },
+        { "MAIZE",                                    static_cast<uint32_t>( hex_color::MAIZE ) },
+        { "MAIZE_CRAYOLA",                            static_cast<uint32_t>( hex_color::MAIZE_CRAYOLA ) },
+        { "MAJORELLE_BLUE",                           static_cast<uint32_t>( hex_color::MAJORELLE_BLUE ) },
+        { "MALACHITE",                                static_cast<uint32_t>( hex_color::MALACHITE ) },
+        { "MANATEE",                                  static_cast<uint32_t>( hex_color::MANATEE ) },
+        { "MANDARIN",                                 static_cast<uint32_t>( hex_color::MANDARIN ) },
+        { "MANGO",                                    static_cast<uint32_t>( hex_color::MANGO ) },
+        { "MANGO_TANGO",                              static_cast<uint32_t>( hex_color::MANGO_TANGO ) },
+        { "MANTIS",                                   static_cast<uint32_t>( hex_color::MANTIS ) },
+        { "MARDI_GRAS",                               static_cast<uint32_t>( hex_color::MARDI_GRAS ) },
+        { "MARIGOLD",                                 static_cast<uint32_t>( hex_color::MARIGOLD ) },
+        { "MAROON_CRAYOLA",                           static_cast<uint32_t>( hex_color::MAROON_CRAYOLA ) },
+        { "MAROON_WEB",                               static_cast<uint32_t>( hex_color::MAROON_WEB ) },
+        { "MAROON_X11",                               static_cast<uint32_t>( hex_color::MAROON_X11 ) },
+        { "MAUVE",                                    static_cast<uint32_t>( hex_color::MAUVE ) },
+        { "MAUVE_TAUPE",                              static_cast<uint32_t>( hex_color::MAUVE_TAUPE ) },
+        { "MAUVELOUS",                                static_cast<uint32_t>( hex_color::MAUVELOUS ) },
+        { "MAXIMUM_BLUE",                             static_cast<uint32_t>( hex_color::MAXIMUM_BLUE ) },
+        { "MAXIMUM_BLUE_GREEN",                       static_cast<uint32_t>( hex_color::MAXIMUM_BLUE_GREEN ) },
+        { "MAXIMUM_BLUE_PURPLE",                      static_cast<uint32_t>( hex_color::MAXIMUM_BLUE_PURPLE ) },
+        { "MAXIMUM_GREEN",                            static_cast<uint32_t>( hex_color::MAXIMUM_GREEN ) },
+        { "MAXIMUM_GREEN_YELLOW",                     static_cast<uint32_t>( hex_color::MAXIMUM_GREEN_YELLOW ) },
+        { "MAXIMUM_PURPLE",                           static_cast<uint32_t>( hex_color::MAXIMUM_PURPLE ) },
+        { "MAXIMUM_RED",                              static_cast<uint32_t>( hex_color::MAXIMUM_RED ) },
+        { "MAXIMUM_RED_PURPLE",                       static_cast<uint32_t>( hex_color::MAXIMUM_RED_PURPLE ) },
+        { "MAXIMUM_YELLOW",                           static_cast<uint32_t>( hex_color::MAXIMUM_YELLOW ) },
+        { "MAXIMUM_YELLOW_RED",                       static_cast<uint32_t>( hex_color::MAXIMUM_YELLOW_RED ) },
+        { "MAY_GREEN",                                static_cast<uint32_t>( hex_color::MAY_GREEN ) },
+        { "MAYA_BLUE",                                static_cast<uint32_t>( hex_color::MAYA_BLUE ) },
+        { "MEDIUM_AQUAMARINE",                        static_cast<uint32_t>( hex_color::MEDIUM_AQUAMARINE ) },
+        { "MEDIUM_BLUE",                              static_cast<uint32_t>( hex_color::MEDIUM_BLUE ) },
+        { "MEDIUM_CANDY_APPLE_RED",                   static_cast<uint32_t>( hex_color::MEDIUM_CANDY_APPLE_RED ) },
+        { "MEDIUM_CARMINE",                           static_cast<uint32_t>( hex_color::MEDIUM_CARMINE ) },
+        { "MEDIUM_CHAMPAGNE",                         static_cast<uint32_t>( hex_color::MEDIUM_CHAMPAGNE ) },
+        { "MEDIUM_ORCHID",                            static_cast<uint32_t>( hex_color::MEDIUM_ORCHID ) },
+        { "MEDIUM_PURPLE",                            static_cast<uint32_t>( hex_color::MEDIUM_PURPLE ) },
+        { "MEDIUM_SEA_GREEN",                         static_cast<uint32_t>( hex_color::MEDIUM_SEA_GREEN ) },
+        { "MEDIUM_SLATE_BLUE",                        static_cast<uint32_t>( hex_color::MEDIUM_SLATE_BLUE ) },
+        { "MEDIUM_SPRING_GREEN",                      static_cast<uint32_t>( hex_color::MEDIUM_SPRING_GREEN ) },
+        { "MEDIUM_TURQUOISE",                         static_cast<uint32_t>( hex_color::MEDIUM_TURQUOISE ) },
+        { "MEDIUM_VIOLET_RED",                        static_cast<uint32_t>( hex_color::MEDIUM_VIOLET_RED ) },
+        { "MELLOW_APRICOT",                           static_cast<uint32_t>( hex_color::MELLOW_APRICOT ) },
+        { "MELLOW_YELLOW",                            static_cast<uint32_t>( hex_color::MELLOW_YELLOW ) },
+        { "MELON",                                    static_cast<uint32_t>( hex_color::MELON ) },
+        { "METALLIC_GOLD",                            static_cast<uint32_t>( hex_color::METALLIC_GOLD ) },
+        { "METALLIC_SEAWEED",                         static_cast<uint32_t>( hex_color::METALLIC_SEAWEED ) },
+        { "METALLIC_SUNBURST",                        static_cast<uint32_t>( hex_color::METALLIC_SUNBURST ) },
+        { "MEXICAN_PINK",                             static_cast<uint32_t>( hex_color::MEXICAN_PINK ) },
+        { "MIDDLE_BLUE",                              static_cast<uint32_t>( hex_color::MIDDLE_BLUE ) },
+        { "MIDDLE_BLUE_GREEN",                        static_cast<uint32_t>( hex_color::MIDDLE_BLUE_GREEN ) },
+        { "MIDDLE_BLUE_PURPLE",                       static_cast<uint32_t>( hex_color::MIDDLE_BLUE_PURPLE ) },
+        { "MIDDLE_GREY",                              static_cast<uint32_t>( hex_color::MIDDLE_GREY ) },
+        { "MIDDLE_GREEN",                             static_cast<uint32_t>( hex_color::MIDDLE_GREEN ) },
+        { "MIDDLE_GREEN_YELLOW",                      static_cast<uint32_t>( hex_color::MIDDLE_GREEN_YELLOW ) },
+        { "MIDDLE_PURPLE",                            static_cast<uint32_t>( hex_color::MIDDLE_PURPLE ) },
+        { "MIDDLE_RED",                               static_cast<uint32_t>( hex_color::MIDDLE_RED ) },
+        { "MIDDLE_RED_PURPLE",                        static_cast<uint32_t>( hex_color::MIDDLE_RED_PURPLE ) },
+        { "MIDDLE_YELLOW",                            static_cast<uint32_t>( hex_color::MIDDLE_YELLOW ) },
+        { "MIDDLE_YELLOW_RED",                        static_cast<uint32_t>( hex_color::MIDDLE_YELLOW_RED ) },
+        { "MIDNIGHT",                                 static_cast<uint32_t>( hex_color::MIDNIGHT ) },
+        { "MIDNIGHT_BLUE",                            static_cast<uint32_t>( hex_color::MIDNIGHT_BLUE ) },
+        { "MIDNIGHT_GREEN",                           static_cast<uint32_t>( hex_color::MIDNIGHT_GREEN ) },
+        { "EAGLE_GREEN",                              static_cast<uint32_t>( hex_color::EAGLE_GREEN ) },
+        { "MIKADO_YELLOW",                            static_cast<uint32_t>( hex_color::MIKADO_YELLOW ) },
+        { "MIMI_PINK",                                static_cast<uint32_t>( hex_color::MIMI_PINK ) },
+        { "MINDARO",                                  static_cast<uint32_t>( hex_color::MINDARO ) },
+        { "MING",                                     static_cast<uint32_t>( hex_color::MING ) },
+        { "MINION_YELLOW",                            static_cast<uint32_t>( hex_color::MINION_YELLOW ) },
+        { "MINT",                                     static_cast<uint32_t>( hex_color::MINT ) },
+        { "MINT_CREAM",                               static_cast<uint32_t>( hex_color::MINT_CREAM ) },
+        { "MINT_GREEN",                               static_cast<uint32_t>( hex_color::MINT_GREEN ) },
+        { "MISTY_MOSS",                               static_cast<uint32_t>( hex_color::MISTY_MOSS ) },
+        { "MISTY_ROSE",                               static_cast<uint32_t>( hex_color::MISTY_ROSE ) },
+        { "MODE_BEIGE",                               static_cast<uint32_t>( hex_color::MODE_BEIGE ) },
+        { "MORNING_BLUE",                             static_cast<uint32_t>( hex_color::MORNING_BLUE ) },
+        { "MOSS_GREEN",                               static_cast<uint32_t>( hex_color::MOSS_GREEN ) },
+        { "MOUNTAIN_MEADOW",                          static_cast<uint32_t>( hex_color::MOUNTAIN_MEADOW ) },
+        { "MOUNTBATTEN_PINK",                         static_cast<uint32_t>( hex_color::MOUNTBATTEN_PINK ) },
+        { "MSU_GREEN",                                static_cast<uint32_t>( hex_color::MSU_GREEN ) },
+        { "MULBERRY",                                 static_cast<uint32_t>( hex_color::MULBERRY ) },
+        { "MULBERRY_CRAYOLA",                         static_cast<uint32_t>( hex_color::MULBERRY_CRAYOLA ) },
+        { "MUSTARD",                                  static_cast<uint32_t>( hex_color::MUSTARD ) },
+        { "MYRTLE_GREEN",                             static_cast<uint32_t>( hex_color::MYRTLE_GREEN ) },
+        { "MYSTIC",                                   static_cast<uint32_t>( hex_color::MYSTIC ) },
+        { "MYSTIC_MAROON",                            static_cast<uint32_t>( hex_color::MYSTIC_MAROON ) },
+        { "NADESHIKO_PINK",                           static_cast<uint32_t>( hex_color::NADESHIKO_PINK ) },
+        { "NAPLES_YELLOW",                            static_cast<uint32_t>( hex_color::NAPLES_YELLOW ) },
+        { "NAVAJO_WHITE",                             static_cast<uint32_t>( hex_color::NAVAJO_WHITE ) },
+        { "NAVY_BLUE",                                static_cast<uint32_t>( hex_color::NAVY_BLUE ) },
+        { "NAVY_BLUE_CRAYOLA",                        static_cast<uint32_t>( hex_color::NAVY_BLUE_CRAYOLA ) },
+        { "NEON_BLUE",                                static_cast<uint32_t>( hex_color::NEON_BLUE ) },
+        { "NEON_CARROT",                              static_cast<uint32_t>( hex_color::NEON_CARROT ) },
+        { "NEON_GREEN",                               static_cast<uint32_t>( hex_color::NEON_GREEN ) },
+        { "NEON_FUCHSIA",                             static_cast<uint32_t>( hex_color::NEON_FUCHSIA ) },
+        { "NEW_YORK_PINK",                            static_cast<uint32_t>( hex_color::NEW_YORK_PINK ) },
+        { "NICKEL",                                   static_cast<uint32_t>( hex_color::NICKEL ) },
+        { "NON_PHOTO_BLUE",                           static_cast<uint32_t>( hex_color::NON_PHOTO_BLUE ) },
+        { "NYANZA",                                   static_cast<uint32_t>( hex_color::NYANZA ) },
+        { "OCEAN_BLUE",                               static_cast<uint32_t>( hex_color::OCEAN_BLUE ) },
+        { "OCEAN_GREEN",                              static_cast<uint32_t>( hex_color::OCEAN_GREEN ) },
+        { "OCHRE",                                    static_cast<uint32_t>( hex_color::OCHRE ) },
+        { "OLD_BURGUNDY",                             static_cast<uint32_t>( hex_color::OLD_BURGUNDY ) },
+        { "OLD_GOLD",                                 static_cast<uint32_t>( hex_color::OLD_GOLD ) },
+        { "OLD_LACE",                                 static_cast<uint32_t>( hex_color::OLD_LACE ) },
+        { "OLD_LAVENDER",                             static_cast<uint32_t>( hex_color::OLD_LAVENDER ) },
+        { "OLD_MAUVE",                                static_cast<uint32_t>( hex_color::OLD_MAUVE ) },
+        { "OLD_ROSE",                                 static_cast<uint32_t>( hex_color::OLD_ROSE ) },
+        { "OLD_SILVER",                               static_cast<uint32_t>( hex_color::OLD_SILVER ) },
+        { "OLIVE",                                    static_cast<uint32_t>( hex_color::OLIVE ) },
+        { "OLIVE_DRAB_NUMBER_3",                      static_cast<uint32_t>( hex_color::OLIVE_DRAB_NUMBER_3 ) },
+        { "OD3",                                      static_cast<uint32_t>( hex_color::OD3 ) },
+        { "OLIVE_DRAB_NUMBER_7",                      static_cast<uint32_t>( hex_color::OLIVE_DRAB_NUMBER_7 ) },
+        { "OD7",                                      static_cast<uint32_t>( hex_color::OD7 ) },
+        { "OLIVE_GREEN",                              static_cast<uint32_t>( hex_color::OLIVE_GREEN ) },
+        { "OLIVINE",                                  static_cast<uint32_t>( hex_color::OLIVINE ) },
+        { "ONYX",                                     static_cast<uint32_t>( hex_color::ONYX ) },
+        { "OPAL",                                     static_cast<uint32_t>( hex_color::OPAL ) },
+        { "OPERA_MAUVE",                              static_cast<uint32_t>( hex_color::OPERA_MAUVE ) },
+        { "ORANGE",                                   static_cast<uint32_t>( hex_color::ORANGE ) },
+        { "ORANGE_CRAYOLA",                           static_cast<uint32_t>( hex_color::ORANGE_CRAYOLA ) },
+        { "ORANGE_PANTONE",                           static_cast<uint32_t>( hex_color::ORANGE_PANTONE ) },
+        { "ORANGE_WEB",                               static_cast<uint32_t>( hex_color::ORANGE_WEB ) },
+        { "ORANGE_PEEL",                              static_cast<uint32_t>( hex_color::ORANGE_PEEL ) },
+        { "ORANGE_RED",                               static_cast<uint32_t>( hex_color::ORANGE_RED ) },
+        { "ORANGE_RED_CRAYOLA",                       static_cast<uint32_t>( hex_color::ORANGE_RED_CRAYOLA ) },
+        { "ORANGE_SODA",                              static_cast<uint32_t>( hex_color::ORANGE_SODA ) },
+        { "ORANGE_YELLOW",                            static_cast<uint32_t>( hex_color::ORANGE_YELLOW ) },
+        { "ORANGE_YELLOW_CRAYOLA",                    static_cast<uint32_t>( hex_color::ORANGE_YELLOW_CRAYOLA ) },
+        { "ORCHID",                                   static_cast<uint32_t>( hex_color::ORCHID ) },
+        { "ORCHID_PINK",                              static_cast<uint32_t>( hex_color::ORCHID_PINK ) },
+        { "ORCHID_CRAYOLA",                           static_cast<uint32_t>( hex_color::ORCHID_CRAYOLA ) },
+        { "OUTER_SPACE_CRAYOLA",                      static_cast<uint32_t>( hex_color::OUTER_SPACE_CRAYOLA ) },
+        { "OUTRAGEOUS_ORANGE",                        static_cast<uint32_t>( hex_color::OUTRAGEOUS_ORANGE ) },
+        { "OXBLOOD",                                  static_cast<uint32_t>( hex_color::OXBLOOD ) },
+        { "OXFORD_BLUE",                              static_cast<uint32_t>( hex_color::OXFORD_BLUE ) },
+        { "OU_CRIMSON_RED",                           static_cast<uint32_t>( hex_color::OU_CRIMSON_RED ) },
+        { "PACIFIC_BLUE",                             static_cast<uint32_t>( hex_color::PACIFIC_BLUE ) },
+        { "PAKISTAN_GREEN",                           static_cast<uint32_t>( hex_color::PAKISTAN_GREEN ) },
+        { "PALATINATE_PURPLE",                        static_cast<uint32_t>( hex_color::PALATINATE_PURPLE ) },
+        { "PALE_AQUA",                                static_cast<uint32_t>( hex_color::PALE_AQUA ) },
+        { "PALE_CERULEAN",                            static_cast<uint32_t>( hex_color::PALE_CERULEAN ) },
+        { "PALE_DOGWOOD",                             static_cast<uint32_t>( hex_color::PALE_DOGWOOD ) },
+        { "PALE_PINK",                                static_cast<uint32_t>( hex_color::PALE_PINK ) },
+        { "PALE_PURPLE_PANTONE",                      static_cast<uint32_t>( hex_color::PALE_PURPLE_PANTONE ) },
+        { "PALE_SILVER",                              static_cast<uint32_t>( hex_color::PALE_SILVER ) },
+        { "PALE_SPRING_BUD",                          static_cast<uint32_t>( hex_color::PALE_SPRING_BUD ) },
+        { "PANSY_PURPLE",                             static_cast<uint32_t>( hex_color::PANSY_PURPLE ) },
+        { "PAOLO_VERONESE_GREEN",                     static_cast<uint32_t>( hex_color::PAOLO_VERONESE_GREEN ) },
+        { "PAPAYA_WHIP",                              static_cast<uint32_t>( hex_color::PAPAYA_WHIP ) },
+        { "PARADISE_PINK",                            static_cast<uint32_t>( hex_color::PARADISE_PINK ) },
+        { "PARCHMENT",                                static_cast<uint32_t>( hex_color::PARCHMENT ) },
+        { "PARIS_GREEN",                              static_cast<uint32_t>( hex_color::PARIS_GREEN ) },
+        { "PASTEL_PINK",                              static_cast<uint32_t>( hex_color::PASTEL_PINK ) },
+        { "PATRIARCH",                                static_cast<uint32_t>( hex_color::PATRIARCH ) },
+        { "PAYNES_GREY",                              static_cast<uint32_t>( hex_color::PAYNES_GREY ) },
+        { "PEACH",                                    static_cast<uint32_t>( hex_color::PEACH ) },
+        { "PEACH_CRAYOLA",                            static_cast<uint32_t>( hex_color::PEACH_CRAYOLA ) },
+        { "PEACH_PUFF",                               static_cast<uint32_t>( hex_color::PEACH_PUFF ) },
+        { "PEAR",                                     static_cast<uint32_t>( hex_color::PEAR ) },
+        { "PEARLY_PURPLE",                            static_cast<uint32_t>( hex_color::PEARLY_PURPLE ) },
+        { "PERIWINKLE",                               static_cast<uint32_t>( hex_color::PERIWINKLE ) },
+        { "PERIWINKLE_CRAYOLA",                       static_cast<uint32_t>( hex_color::PERIWINKLE_CRAYOLA ) },
+        { "PERMANENT_GERANIUM_LAKE",                  static_cast<uint32_t>( hex_color::PERMANENT_GERANIUM_LAKE ) },
+        { "PERSIAN_BLUE",                             static_cast<uint32_t>( hex_color::PERSIAN_BLUE ) },
+        { "PERSIAN_GREEN",                            static_cast<uint32_t>( hex_color::PERSIAN_GREEN ) },
+        { "PERSIAN_INDIGO",                           static_cast<uint32_t>( hex_color::PERSIAN_INDIGO ) },
+        { "PERSIAN_ORANGE",                           static_cast<uint32_t>( hex_color::PERSIAN_ORANGE ) },
+        { "PERSIAN_PINK",                             static_cast<uint32_t>( hex_color::PERSIAN_PINK ) },
+        { "PERSIAN_PLUM",                             static_cast<uint32_t>( hex_color::PERSIAN_PLUM ) },
+        { "PERSIAN_RED",                              static_cast<uint32_t>( hex_color::PERSIAN_RED ) },
+        { "PERSIAN_ROSE",                             static_cast<uint32_t>( hex_color::PERSIAN_ROSE ) },
+        { "PERSIMMON",                                static_cast<uint32_t>( hex_color::PERSIMMON ) },
+        { "PEWTER_BLUE",                              static_cast<uint32_t>( hex_color::PEWTER_BLUE ) },
+        { "PHLOX",                                    static_cast<uint32_t>( hex_color::PHLOX ) },
+        { "PHTHALO_BLUE",                             static_cast<uint32_t>( hex_color::PHTHALO_BLUE ) },
+        { "PHTHALO_GREEN",                            static_cast<uint32_t>( hex_color::PHTHALO_GREEN ) },
+        { "PICOTEE_BLUE",                             static_cast<uint32_t>( hex_color::PICOTEE_BLUE ) },
+        { "PICTORIAL_CARMINE",                        static_cast<uint32_t>( hex_color::PICTORIAL_CARMINE ) },
+        { "PIGGY_PINK",                               static_cast<uint32_t>( hex_color::PIGGY_PINK ) },
+        { "PINE_GREEN",                               static_cast<uint32_t>( hex_color::PINE_GREEN ) },
+        { "PINE_TREE",                                static_cast<uint32_t>( hex_color::PINE_TREE ) },
+        { "PINK",                                     static_cast<uint32_t>( hex_color::PINK ) },
+        { "PINK_PANTONE",                             static_cast<uint32_t>( hex_color::PINK_PANTONE ) },
+        { "PINK_FLAMINGO",                            static_cast<uint32_t>( hex_color::PINK_FLAMINGO ) },
+        { "PINK_LACE",                                static_cast<uint32_t>( hex_color::PINK_LACE ) },
+        { "PINK_LAVENDER",                            static_cast<uint32_t>( hex_color::PINK_LAVENDER ) },
+        { "PINK_SHERBET",                             static_cast<uint32_t>( hex_color::PINK_SHERBET ) },
+        { "PISTACHIO",                                static_cast<uint32_t>( hex_color::PISTACHIO ) },
+        { "PLATINUM",                                 static_cast<uint32_t>( hex_color::PLATINUM ) },
+        { "PLUM",                                     static_cast<uint32_t>( hex_color::PLUM ) },
+        { "PLUM_WEB",                                 static_cast<uint32_t>( hex_color::PLUM_WEB ) },
+        { "PLUMP_PURPLE",                             static_cast<uint32_t>( hex_color::PLUMP_PURPLE ) },
+        { "POLISHED_PINE",                            static_cast<uint32_t>( hex_color::POLISHED_PINE ) },
+        { "POMP_AND_POWER",                           static_cast<uint32_t>( hex_color::POMP_AND_POWER ) },
+        { "POPSTAR",                                  static_cast<uint32_t>( hex_color::POPSTAR ) },
+        { "PORTLAND_ORANGE",                          static_cast<uint32_t>( hex_color::PORTLAND_ORANGE ) },
+        { "POWDER_BLUE",                              static_cast<uint32_t>( hex_color::POWDER_BLUE ) },
+        { "PRINCETON_ORANGE",                         static_cast<uint32_t>( hex_color::PRINCETON_ORANGE ) },
+        { "PROCESS_YELLOW",                           static_cast<uint32_t>( hex_color::PROCESS_YELLOW ) },
+        { "PRUNE",                                    static_cast<uint32_t>( hex_color::PRUNE ) },
+        { "PRUSSIAN_BLUE",                            static_cast<uint32_t>( hex_color::PRUSSIAN_BLUE ) },
+        { "PSYCHEDELIC_PURPLE",                       static_cast<uint32_t>( hex_color::PSYCHEDELIC_PURPLE ) },
+        { "PUCE",                                     static_cast<uint32_t>( hex_color::PUCE ) },
+        { "PULLMAN_BROWN",                            static_cast<uint32_t>( hex_color::PULLMAN_BROWN ) },
+        { "UPS_BROWN",                                static_cast<uint32_t>( hex_color::UPS_BROWN ) },
+        { "PUMPKIN",                                  static_cast<uint32_t>( hex_color::PUMPKIN ) },
+        { "PURPLE",                                   static_cast<uint32_t>( hex_color::PURPLE ) },
+        { "PURPLE_WEB",                               static_cast<uint32_t>( hex_color::PURPLE_WEB ) },
+        { "PURPLE_MUNSELL",                           static_cast<uint32_t>( hex_color::PURPLE_MUNSELL ) },
+        { "PURPLE_X11",                               static_cast<uint32_t>( hex_color::PURPLE_X11 ) },
+        { "PURPLE_MOUNTAIN_MAJESTY",                  static_cast<uint32_t>( hex_color::PURPLE_MOUNTAIN_MAJESTY ) },
+        { "PURPLE_NAVY",                              static_cast<uint32_t>( hex_color::PURPLE_NAVY ) },
+        { "PURPLE_PIZZAZZ",                           static_cast<uint32_t>( hex_color::PURPLE_PIZZAZZ ) },
+        { "PURPLE_PLUM",                              static_cast<uint32_t>( hex_color::PURPLE_PLUM ) },
+        { "PURPUREUS",                                static_cast<uint32_t>( hex_color::PURPUREUS ) },
+        { "QUEEN_BLUE",                               static_cast<uint32_t>( hex_color::QUEEN_BLUE ) },
+        { "QUEEN_PINK",                               static_cast<uint32_t>( hex_color::QUEEN_PINK ) },
+        { "QUICK_SILVER",                             static_cast<uint32_t>( hex_color::QUICK_SILVER ) },
+        { "QUINACRIDONE_MAGENTA",                     static_cast<uint32_t>( hex_color::QUINACRIDONE_MAGENTA ) },
+        { "RADICAL_RED",                              static_cast<uint32_t>( hex_color::RADICAL_RED ) },
+        { "RAISIN_BLACK",                             static_cast<uint32_t>( hex_color::RAISIN_BLACK ) },
+        { "RAJAH",                                    static_cast<uint32_t>( hex_color::RAJAH ) },
+        { "RASPBERRY",                                static_cast<uint32_t>( hex_color::RASPBERRY ) },
+        { "RASPBERRY_GLACE",                          static_cast<uint32_t>( hex_color::RASPBERRY_GLACE ) },
+        { "RASPBERRY_ROSE",                           static_cast<uint32_t>( hex_color::RASPBERRY_ROSE ) },
+        { "RAW_SIENNA",                               static_cast<uint32_t>( hex_color::RAW_SIENNA ) },
+        { "RAW_UMBER",                                static_cast<uint32_t>( hex_color::RAW_UMBER ) },
+        { "RAZZLE_DAZZLE_ROSE",                       static_cast<uint32_t>( hex_color::RAZZLE_DAZZLE_ROSE ) },
+        { "RAZZMATAZZ",                               static_cast<uint32_t>( hex_color::RAZZMATAZZ ) },
+        { "RAZZMIC_BERRY",                            static_cast<uint32_t>( hex_color::RAZZMIC_BERRY ) },
+        { "REBECCA_PURPLE",                           static_cast<uint32_t>( hex_color::REBECCA_PURPLE ) },
+        { "RED",                                      static_cast<uint32_t>( hex_color::RED ) },
+        { "RED_CRAYOLA",                              static_cast<uint32_t>( hex_color::RED_CRAYOLA ) },
+        { "RED_MUNSELL",                              static_cast<uint32_t>( hex_color::RED_MUNSELL ) },
+        { "RED_NCS",                                  static_cast<uint32_t>( hex_color::RED_NCS ) },
+        { "RED_PANTONE",                              static_cast<uint32_t>( hex_color::RED_PANTONE ) },
+        { "RED_PIGMENT",                              static_cast<uint32_t>( hex_color::RED_PIGMENT ) },
+        { "RED_RYB",                                  static_cast<uint32_t>( hex_color::RED_RYB ) },
+        { "RED_ORANGE",                               static_cast<uint32_t>( hex_color::RED_ORANGE ) },
+        { "RED_ORANGE_CRAYOLA",                       static_cast<uint32_t>( hex_color::RED_ORANGE_CRAYOLA ) },
+        { "RED_ORANGE_COLOR_WHEEL",                   static_cast<uint32_t>( hex_color::RED_ORANGE_COLOR_WHEEL ) },
+        { "RED_PURPLE",                               static_cast<uint32_t>( hex_color::RED_PURPLE ) },
+        { "RED_SALSA",                                static_cast<uint32_t>( hex_color::RED_SALSA ) },
+        { "RED_VIOLET",                               static_cast<uint32_t>( hex_color::RED_VIOLET ) },
+        { "RED_VIOLET_CRAYOLA",                       static_cast<uint32_t>( hex_color::RED_VIOLET_CRAYOLA ) },
+        { "RED_VIOLET_COLOR_WHEEL",                   static_cast<uint32_t>( hex_color::RED_VIOLET_COLOR_WHEEL ) },
+        { "REDWOOD",                                  static_cast<uint32_t>( hex_color::REDWOOD ) },
+        { "RESOLUTION_BLUE",                          static_cast<uint32_t>( hex_color::RESOLUTION_BLUE ) },
+        { "RHYTHM",                                   static_cast<uint32_t>( hex_color::RHYTHM ) },
+        { "RICH_BLACK",                               static_cast<uint32_t>( hex_color::RICH_BLACK ) },
+        { "RICH_BLACK_FOGRA29",                       static_cast<uint32_t>( hex_color::RICH_BLACK_FOGRA29 ) },
+        { "RICH_BLACK_FOGRA39",                       static_cast<uint32_t>( hex_color::RICH_BLACK_FOGRA39 ) },
+        { "RIFLE_GREEN",                              static_cast<uint32_t>( hex_color::RIFLE_GREEN ) },
+        { "ROBIN_EGG_BLUE",                           static_cast<uint32_t>( hex_color::ROBIN_EGG_BLUE ) },
+        { "ROCKET_METALLIC",                          static_cast<uint32_t>( hex_color::ROCKET_METALLIC ) },
+        { "ROJO_SPANISH_RED",                         static_cast<uint32_t>( hex_color::ROJO_SPANISH_RED ) },
+        { "ROMAN_SILVER",                             static_cast<uint32_t>( hex_color::ROMAN_SILVER ) },
+        { "ROSE",                                     static_cast<uint32_t>( hex_color::ROSE ) },
+        { "ROSE_BONBON",                              static_cast<uint32_t>( hex_color::ROSE_BONBON ) },
+        { "ROSE_DUST",                                static_cast<uint32_t>( hex_color::ROSE_DUST ) },
+        { "ROSE_EBONY",                               static_cast<uint32_t>( hex_color::ROSE_EBONY ) },
+        { "ROSE_MADDER",                              static_cast<uint32_t>( hex_color::ROSE_MADDER ) },
+        { "ROSE_PINK",                                static_cast<uint32_t>( hex_color::ROSE_PINK ) },
+        { "ROSE_POMPADOUR",                           static_cast<uint32_t>( hex_color::ROSE_POMPADOUR ) },
+        { "ROSE_QUARTZ",                              static_cast<uint32_t>( hex_color::ROSE_QUARTZ ) },
+        { "ROSE_RED",                                 static_cast<uint32_t>( hex_color::ROSE_RED ) },
+        { "ROSE_TAUPE",                               static_cast<uint32_t>( hex_color::ROSE_TAUPE ) },
+        { "ROSE_VALE",                                static_cast<uint32_t>( hex_color::ROSE_VALE ) },
+        { "ROSEWOOD",                                 static_cast<uint32_t>( hex_color::ROSEWOOD ) },
+        { "ROSSO_CORSA",                              static_cast<uint32_t>( hex_color::ROSSO_CORSA ) },
+        { "ROSY_BROWN",                               static_cast<uint32_t>( hex_color::ROSY_BROWN ) },
+        { "ROYAL_BLUE_DARK",                          static_cast<uint32_t>( hex_color::ROYAL_BLUE_DARK ) },
+        { "ROYAL_BLUE_LIGHT",                         static_cast<uint32_t>( hex_color::ROYAL_BLUE_LIGHT ) },
+        { "ROYAL_PURPLE",                             static_cast<uint32_t>( hex_color::ROYAL_PURPLE ) },
+        { "ROYAL_YELLOW",                             static_cast<uint32_t>( hex_color::ROYAL_YELLOW ) },
+        { "RUBER",                                    static_cast<uint32_t>( hex_color::RUBER ) },
+        { "RUBINE_RED",                               static_cast<uint32_t>( hex_color::RUBINE_RED ) },
+        { "RUBY",                                     static_cast<uint32_t>( hex_color::RUBY ) },
+        { "RUBY_RED",                                 static_cast<uint32_t>( hex_color::RUBY_RED ) },
+        { "RUFOUS",                                   static_cast<uint32_t>( hex_color::RUFOUS ) },
+        { "RUSSET",                                   static_cast<uint32_t>( hex_color::RUSSET ) },
+        { "RUSSIAN_GREEN",                            static_cast<uint32_t>( hex_color::RUSSIAN_GREEN ) },
+        { "RUSSIAN_VIOLET",                           static_cast<uint32_t>( hex_color::RUSSIAN_VIOLET ) },
+        { "RUST",                                     static_cast<uint32_t>( hex_color::RUST ) },
+        { "RUSTY_RED",                                static_cast<uint32_t>( hex_color::RUSTY_RED ) },
+        { "SACRAMENTO_STATE_GREEN",                   static_cast<uint32_t>( hex_color::SACRAMENTO_STATE_GREEN ) },
+        { "SADDLE_BROWN",                             static_cast<uint32_t>( hex_color::SADDLE_BROWN ) },
+        { "SAFETY_ORANGE_1",                          static_cast<uint32_t>( hex_color::SAFETY_ORANGE_1 ) },
+        { "SAFETY_ORANGE_2",                          static_cast<uint32_t>( hex_color::SAFETY_ORANGE_2 ) },
+        { "BLAZE_ORANGE",                             static_cast<uint32_t>( hex_color::BLAZE_ORANGE ) },
+        { "SAFETY_YELLOW",                            static_cast<uint32_t>( hex_color::SAFETY_YELLOW ) },
+        { "SAFFRON",                                  static_cast<uint32_t>( hex_color::SAFFRON ) },
+        { "SAGE",                                     static_cast<uint32_t>( hex_color::SAGE ) },
+        { "ST_PATRICKS_BLUE",                         static_cast<uint32_t>( hex_color::ST_PATRICKS_BLUE ) },
+        { "SALMON",                                   static_cast<uint32_t>( hex_color::SALMON ) },
+        { "SALMON_PINK",                              static_cast<uint32_t>( hex_color::SALMON_PINK ) },
+        { "SAND",                                     static_cast<uint32_t>( hex_color::SAND ) },
+        { "SAND_DUNE",                                static_cast<uint32_t>( hex_color::SAND_DUNE ) },
+        { "SANDY_BROWN",                              static_cast<uint32_t>( hex_color::SANDY_BROWN ) },
+        { "SAP_GREEN",                                static_cast<uint32_t>( hex_color::SAP_GREEN ) },
+        { "SAPPHIRE",                                 static_cast<uint32_t>( hex_color::SAPPHIRE ) },
+        { "SAPPHIRE_BLUE",                            static_cast<uint32_t>( hex_color::SAPPHIRE_BLUE ) },
+        { "SAPPHIRE_CRAYOLA",                         static_cast<uint32_t>( hex_color::SAPPHIRE_CRAYOLA ) },
+        { "SATIN_SHEEN_GOLD",                         static_cast<uint32_t>( hex_color::SATIN_SHEEN_GOLD ) },
+        { "SCARLET",                                  static_cast<uint32_t>( hex_color::SCARLET ) },
+        { "SCHAUSS_PINK",                             static_cast<uint32_t>( hex_color::SCHAUSS_PINK ) },
+        { "SCHOOL_BUS_YELLOW",                        static_cast<uint32_t>( hex_color::SCHOOL_BUS_YELLOW ) },
+        { "SCREAMIN_GREEN",                           static_cast<uint32_t>( hex_color::SCREAMIN_GREEN ) },
+        { "SEA_GREEN",                                static_cast<uint32_t>( hex_color::SEA_GREEN ) },
+        { "SEA_GREEN_CRAYOLA",                        static_cast<uint32_t>( hex_color::SEA_GREEN_CRAYOLA ) },
+        { "SEAL_BROWN",                               static_cast<uint32_t>( hex_color::SEAL_BROWN ) },
+        { "SEASHELL",                                 static_cast<uint32_t>( hex_color::SEASHELL ) },
+        { "SELECTIVE_YELLOW",                         static_cast<uint32_t>( hex_color::SELECTIVE_YELLOW ) },
+        { "SEPIA",                                    static_cast<uint32_t>( hex_color::SEPIA ) },
+        { "SHADOW",                                   static_cast<uint32_t>( hex_color::SHADOW ) },
+        { "SHADOW_BLUE",                              static_cast<uint32_t>( hex_color::SHADOW_BLUE ) },
+        { "SHAMROCK_GREEN",                           static_cast<uint32_t>( hex_color::SHAMROCK_GREEN ) },
+        { "SHEEN_GREEN",                              static_cast<uint32_t>( hex_color::SHEEN_GREEN ) },
+        { "SHIMMERING_BLUSH",                         static_cast<uint32_t>( hex_color::SHIMMERING_BLUSH ) },
+        { "SHINY_SHAMROCK",                           static_cast<uint32_t>( hex_color::SHINY_SHAMROCK ) },
+        { "SHOCKING_PINK",                            static_cast<uint32_t>( hex_color::SHOCKING_PINK ) },
+        { "SHOCKING_PINK_CRAYOLA",                    static_cast<uint32_t>( hex_color::SHOCKING_PINK_CRAYOLA ) },
+        { "SIENNA",                                   static_cast<uint32_t>( hex_color::SIENNA ) },
+        { "SILVER",                                   static_cast<uint32_t>( hex_color::SILVER ) },
+        { "SILVER_CRAYOLA",                           static_cast<uint32_t>( hex_color::SILVER_CRAYOLA ) },
+        { "SILVER_METALLIC",                          static_cast<uint32_t>( hex_color::SILVER_METALLIC ) },
+        { "SILVER_CHALICE",                           static_cast<uint32_t>( hex_color::SILVER_CHALICE ) },
+        { "SILVER_PINK",                              static_cast<uint32_t>( hex_color::SILVER_PINK ) },
+        { "SILVER_SAND",                              static_cast<uint32_t>( hex_color::SILVER_SAND ) },
+        { "SINOPIA",                                  static_cast<uint32_t>( hex_color::SINOPIA ) },
+        { "SIZZLING_RED",                             static_cast<uint32_t>( hex_color::SIZZLING_RED ) },
+        { "SIZZLING_SUNRISE",                         static_cast<uint32_t>( hex_color::SIZZLING_SUNRISE ) },
+        { "SKOBELOFF",                                static_cast<uint32_t>( hex_color::SKOBELOFF ) },
+        { "SKY_BLUE",                                 static_cast<uint32_t>( hex_color::SKY_BLUE ) },
+        { "SKY_BLUE_CRAYOLA",                         static_cast<uint32_t>( hex_color::SKY_BLUE_CRAYOLA ) },
+        { "SKY_MAGENTA",                              static_cast<uint32_t>( hex_color::SKY_MAGENTA ) },
+        { "SLATE_BLUE",                               static_cast<uint32_t>( hex_color::SLATE_BLUE ) },
+        { "SLATE_GRAY",                               static_cast<uint32_t>( hex_color::SLATE_GRAY ) },
+        { "SLIMY_GREEN",                              static_cast<uint32_t>( hex_color::SLIMY_GREEN ) },
+        { "SMITTEN",                                  static_cast<uint32_t>( hex_color::SMITTEN ) },
+        { "SMOKY_BLACK",                              static_cast<uint32_t>( hex_color::SMOKY_BLACK ) },
+        { "SNOW",                                     static_cast<uint32_t>( hex_color::SNOW ) },
+        { "SOLID_PINK",                               static_cast<uint32_t>( hex_color::SOLID_PINK ) },
+        { "SONIC_SILVER",                             static_cast<uint32_t>( hex_color::SONIC_SILVER ) },
+        { "SPACE_CADET",                              static_cast<uint32_t>( hex_color::SPACE_CADET ) },
+        { "SPANISH_BISTRE",                           static_cast<uint32_t>( hex_color::SPANISH_BISTRE ) },
+        { "SPANISH_BLUE",                             static_cast<uint32_t>( hex_color::SPANISH_BLUE ) },
+        { "SPANISH_CARMINE",                          static_cast<uint32_t>( hex_color::SPANISH_CARMINE ) },
+        { "SPANISH_GRAY",                             static_cast<uint32_t>( hex_color::SPANISH_GRAY ) },
+        { "SPANISH_GREEN",                            static_cast<uint32_t>( hex_color::SPANISH_GREEN ) },
+        { "SPANISH_ORANGE",                           static_cast<uint32_t>( hex_color::SPANISH_ORANGE ) },
+        { "SPANISH_PINK",                             static_cast<uint32_t>( hex_color::SPANISH_PINK ) },
+        { "SPANISH_RED",                              static_cast<uint32_t>( hex_color::SPANISH_RED ) },
+        { "SPANISH_SKY_BLUE",                         static_cast<uint32_t>( hex_color::SPANISH_SKY_BLUE ) },
+        { "SPANISH_VIOLET",                           static_cast<uint32_t>( hex_color::SPANISH_VIOLET ) },
+        { "SPANISH_VIRIDIAN",                         static_cast<uint32_t>( hex_color::SPANISH_VIRIDIAN ) },
+        { "SPRING_BUD",                               static_cast<uint32_t>( hex_color::SPRING_BUD ) },
+        { "SPRING_FROST",                             static_cast<uint32_t>( hex_color::SPRING_FROST ) },
+        { "SPRING_GREEN",                             static_cast<uint32_t>( hex_color::SPRING_GREEN ) },
+        { "SPRING_GREEN_CRAYOLA",                     static_cast<uint32_t>( hex_color::SPRING_GREEN_CRAYOLA ) },
+        { "STAR_COMMAND_BLUE",                        static_cast<uint32_t>( hex_color::STAR_COMMAND_BLUE ) },
+        { "STEEL_BLUE",                               static_cast<uint32_t>( hex_color::STEEL_BLUE ) },
+        { "STEEL_PINK",                               static_cast<uint32_t>( hex_color::STEEL_PINK ) },
+        { "STEEL_TEAL",                               static_cast<uint32_t>( hex_color::STEEL_TEAL ) },
+        { "STIL_DE_GRAIN_YELLOW",                     static_cast<uint32_t>( hex_color::STIL_DE_GRAIN_YELLOW ) },
+        { "STRAW",                                    static_cast<uint32_t>( hex_color::STRAW ) },
+        { "STRAWBERRY",                               static_cast<uint32_t>( hex_color::STRAWBERRY ) },
+        { "STRAWBERRY_BLONDE",                        static_cast<uint32_t>( hex_color::STRAWBERRY_BLONDE ) },
+        { "SUGAR_PLUM",                               static_cast<uint32_t>( hex_color::SUGAR_PLUM ) },
+        { "SUNGLOW",                                  static_cast<uint32_t>( hex_color::SUNGLOW ) },
+        { "SUNRAY",                                   static_cast<uint32_t>( hex_color::SUNRAY ) },
+        { "SUNSET",                                   static_cast<uint32_t>( hex_color::SUNSET ) },
+        { "SUPER_PINK",                               static_cast<uint32_t>( hex_color::SUPER_PINK ) },
+        { "SWEET_BROWN",                              static_cast<uint32_t>( hex_color::SWEET_BROWN ) },
+        { "SYRACUSE_ORANGE",                          static_cast<uint32_t>( hex_color::SYRACUSE_ORANGE ) },
+        { "TAN",                                      static_cast<uint32_t>( hex_color::TAN ) },
+        { "TAN_CRAYOLA",                              static_cast<uint32_t>( hex_color::TAN_CRAYOLA ) },
+        { "TANGERINE",                                static_cast<uint32_t>( hex_color::TANGERINE ) },
+        { "TANGO_PINK",                               static_cast<uint32_t>( hex_color::TANGO_PINK ) },
+        { "TART_ORANGE",                              static_cast<uint32_t>( hex_color::TART_ORANGE ) },
+        { "TAUPE",                                    static_cast<uint32_t>( hex_color::TAUPE ) },
+        { "TAUPE_GRAY",                               static_cast<uint32_t>( hex_color::TAUPE_GRAY ) },
+        { "TEA_GREEN",                                static_cast<uint32_t>( hex_color::TEA_GREEN ) },
+        { "TEA_ROSE_1",                               static_cast<uint32_t>( hex_color::TEA_ROSE_1 ) },
+        { "TEA_ROSE_2",                               static_cast<uint32_t>( hex_color::TEA_ROSE_2 ) },
+        { "TEAL",                                     static_cast<uint32_t>( hex_color::TEAL ) },
+        { "TEAL_BLUE",                                static_cast<uint32_t>( hex_color::TEAL_BLUE ) },
+        { "TELEMAGENTA",                              static_cast<uint32_t>( hex_color::TELEMAGENTA ) },
+        { "TENNÉ_TAWNY",                              static_cast<uint32_t>( hex_color::TENNÉ_TAWNY ) },
+        { "TENNE_TAWNY",                              static_cast<uint32_t>( hex_color::TENNE_TAWNY ) },
+        { "TERRA_COTTA",                              static_cast<uint32_t>( hex_color::TERRA_COTTA ) },
+        { "THISTLE",                                  static_cast<uint32_t>( hex_color::THISTLE ) },
+        { "THULIAN_PINK",                             static_cast<uint32_t>( hex_color::THULIAN_PINK ) },
+        { "TICKLE_ME_PINK",                           static_cast<uint32_t>( hex_color::TICKLE_ME_PINK ) },
+        { "TIFFANY_BLUE",                             static_cast<uint32_t>( hex_color::TIFFANY_BLUE ) },
+        { "TIMBERWOLF",                               static_cast<uint32_t>( hex_color::TIMBERWOLF ) },
+        { "TITANIUM_YELLOW",                          static_cast<uint32_t>( hex_color::TITANIUM_YELLOW ) },
+        { "TOMATO",                                   static_cast<uint32_t>( hex_color::TOMATO ) },
+        { "TROPICAL_RAINFOREST",                      static_cast<uint32_t>( hex_color::TROPICAL_RAINFOREST ) },
+        { "TRUE_BLUE",                                static_cast<uint32_t>( hex_color::TRUE_BLUE ) },
+        { "TRYPAN_BLUE",                              static_cast<uint32_t>( hex_color::TRYPAN_BLUE ) },
+        { "TUFTS_BLUE",                               static_cast<uint32_t>( hex_color::TUFTS_BLUE ) },
+        { "TUMBLEWEED",                               static_cast<uint32_t>( hex_color::TUMBLEWEED ) },
+        { "TURQUOISE",                                static_cast<uint32_t>( hex_color::TURQUOISE ) },
+        { "TURQUOISE_BLUE",                           static_cast<uint32_t>( hex_color::TURQUOISE_BLUE ) },
+        { "TURQUOISE_GREEN",                          static_cast<uint32_t>( hex_color::TURQUOISE_GREEN ) },
+        { "TURTLE_GREEN",                             static_cast<uint32_t>( hex_color::TURTLE_GREEN ) },
+        { "TUSCAN",                                   static_cast<uint32_t>( hex_color::TUSCAN ) },
+        { "TUSCAN_BROWN",                             static_cast<uint32_t>( hex_color::TUSCAN_BROWN ) },
+        { "TUSCAN_RED",                               static_cast<uint32_t>( hex_color::TUSCAN_RED ) },
+        { "TUSCAN_TAN",                               static_cast<uint32_t>( hex_color::TUSCAN_TAN ) },
+        { "TUSCANY",                                  static_cast<uint32_t>( hex_color::TUSCANY ) },
+        { "TWILIGHT_LAVENDER",                        static_cast<uint32_t>( hex_color::TWILIGHT_LAVENDER ) },
+        { "TYRIAN_PURPLE",                            static_cast<uint32_t>( hex_color::TYRIAN_PURPLE ) },
+        { "UA_BLUE",                                  static_cast<uint32_t>( hex_color::UA_BLUE ) },
+        { "UA_RED",                                   static_cast<uint32_t>( hex_color::UA_RED ) },
+        { "ULTRAMARINE",                              static_cast<uint32_t>( hex_color::ULTRAMARINE ) },
+        { "ULTRAMARINE_BLUE",                         static_cast<uint32_t>( hex_color::ULTRAMARINE_BLUE ) },
+        { "ULTRA_PINK",                               static_cast<uint32_t>( hex_color::ULTRA_PINK ) },
+        { "ULTRA_RED",                                static_cast<uint32_t>( hex_color::ULTRA_RED ) },
+        { "UMBER",                                    static_cast<uint32_t>( hex_color::UMBER ) },
+        { "UNBLEACHED_SILK",                          static_cast<uint32_t>( hex_color::UNBLEACHED_SILK ) },
+        { "UNITED_NATIONS_BLUE",                      static_cast<uint32_t>( hex_color::UNITED_NATIONS_BLUE ) },
+        { "UNIVERSITY_OF_PENNSYLVANIA_RED",           static_cast<uint32_t>( hex_color::UNIVERSITY_OF_PENNSYLVANIA_RED ) },
+        { "UNMELLOW_YELLOW",                          static_cast<uint32_t>( hex_color::UNMELLOW_YELLOW ) },
+        { "UP_FOREST_GREEN",                          static_cast<uint32_t>( hex_color::UP_FOREST_GREEN ) },
+        { "UP_MAROON",                                static_cast<uint32_t>( hex_color::UP_MAROON ) },
+        { "UPSDELL_RED",                              static_cast<uint32_t>( hex_color::UPSDELL_RED ) },
+        { "URANIAN_BLUE",                             static_cast<uint32_t>( hex_color::URANIAN_BLUE ) },
+        { "USAFA_BLUE",                               static_cast<uint32_t>( hex_color::USAFA_BLUE ) },
+        { "UNITED_STATES_AIRFORCE_ACADEMY_BLUE",      static_cast<uint32_t>( hex_color::UNITED_STATES_AIRFORCE_ACADEMY_BLUE ) },
+        { "VAN_DYKE_BROWN",                           static_cast<uint32_t>( hex_color::VAN_DYKE_BROWN ) },
+        { "VANILLA",                                  static_cast<uint32_t>( hex_color::VANILLA ) },
+        { "VANILLA_ICE",                              static_cast<uint32_t>( hex_color::VANILLA_ICE ) },
+        { "VEGAS_GOLD",                               static_cast<uint32_t>( hex_color::VEGAS_GOLD ) },
+        { "VENETIAN_RED",                             static_cast<uint32_t>( hex_color::VENETIAN_RED ) },
+        { "VERDIGRIS",                                static_cast<uint32_t>( hex_color::VERDIGRIS ) },
+        { "VERMILION_1",                              static_cast<uint32_t>( hex_color::VERMILION_1 ) },
+        { "VERMILION_2",                              static_cast<uint32_t>( hex_color::VERMILION_2 ) },
+        { "VERONICA",                                 static_cast<uint32_t>( hex_color::VERONICA ) },
+        { "VIOLET",                                   static_cast<uint32_t>( hex_color::VIOLET ) },
+        { "VIOLET_COLOR_WHEEL",                       static_cast<uint32_t>( hex_color::VIOLET_COLOR_WHEEL ) },
+        { "VIOLET_CRAYOLA",                           static_cast<uint32_t>( hex_color::VIOLET_CRAYOLA ) },
+        { "VIOLET_RYB",                               static_cast<uint32_t>( hex_color::VIOLET_RYB ) },
+        { "VIOLET_WEB",                               static_cast<uint32_t>( hex_color::VIOLET_WEB ) },
+        { "VIOLET_BLUE",                              static_cast<uint32_t>( hex_color::VIOLET_BLUE ) },
+        { "VIOLET_BLUE_CRAYOLA",                      static_cast<uint32_t>( hex_color::VIOLET_BLUE_CRAYOLA ) },
+        { "VIOLET_RED",                               static_cast<uint32_t>( hex_color::VIOLET_RED ) },
+        { "VIRIDIAN",                                 static_cast<uint32_t>( hex_color::VIRIDIAN ) },
+        { "VIRIDIAN_GREEN",                           static_cast<uint32_t>( hex_color::VIRIDIAN_GREEN ) },
+        { "VIVID_BURGUNDY",                           static_cast<uint32_t>( hex_color::VIVID_BURGUNDY ) },
+        { "VIVID_SKY_BLUE",                           static_cast<uint32_t>( hex_color::VIVID_SKY_BLUE ) },
+        { "VIVID_TANGERINE",                          static_cast<uint32_t>( hex_color::VIVID_TANGERINE ) },
+        { "VIVID_VIOLET",                             static_cast<uint32_t>( hex_color::VIVID_VIOLET ) },
+        { "VOLT",                                     static_cast<uint32_t>( hex_color::VOLT ) },
+        { "WARM_BLACK",                               static_cast<uint32_t>( hex_color::WARM_BLACK ) },
+        { "WHEAT",                                    static_cast<uint32_t>( hex_color::WHEAT ) },
+        { "WHITE",                                    static_cast<uint32_t>( hex_color::WHITE ) },
+        { "WILD_BLUE_YONDER",                         static_cast<uint32_t>( hex_color::WILD_BLUE_YONDER ) },
+        { "WILD_ORCHID",                              static_cast<uint32_t>( hex_color::WILD_ORCHID ) },
+        { "WILD_STRAWBERRY",                          static_cast<uint32_t>( hex_color::WILD_STRAWBERRY ) },
+        { "WILD_WATERMELON",                          static_cast<uint32_t>( hex_color::WILD_WATERMELON ) },
+        { "WINDSOR_TAN",                              static_cast<uint32_t>( hex_color::WINDSOR_TAN ) },
+        { "WINE",                                     static_cast<uint32_t>( hex_color::WINE ) },
+        { "WINE_DREGS",                               static_cast<uint32_t>( hex_color::WINE_DREGS ) },
+        { "WINTER_SKY",                               static_cast<uint32_t>( hex_color::WINTER_SKY ) },
+        { "WINTERGREEN_DREAM",                        static_cast<uint32_t>( hex_color::WINTERGREEN_DREAM ) },
+        { "WISTERIA",                                 static_cast<uint32_t>( hex_color::WISTERIA ) },
+        { "WOOD_BROWN",                               static_cast<uint32_t>( hex_color::WOOD_BROWN ) },
+        { "XANADU",                                   static_cast<uint32_t>( hex_color::XANADU ) },
+        { "XANTHIC",                                  static_cast<uint32_t>( hex_color::XANTHIC ) },
+        { "XANTHOUS",                                 static_cast<uint32_t>( hex_color::XANTHOUS ) },
+        { "YALE_BLUE",                                static_cast<uint32_t>( hex_color::YALE_BLUE ) },
+        { "YELLOW",                                   static_cast<uint32_t>( hex_color::YELLOW ) },
+        { "YELLOW_CRAYOLA",                           static_cast<uint32_t>( hex_color::YELLOW_CRAYOLA ) },
+        { "YELLOW_MUNSELL",                           static_cast<uint32_t>( hex_color::YELLOW_MUNSELL ) },
+        { "YELLOW_NCS",                               static_cast<uint32_t>( hex_color::YELLOW_NCS ) },
+        { "YELLOW_PANTONE",                           static_cast<uint32_t>( hex_color::YELLOW_PANTONE ) },
+        { "YELLOW_PROCESS",                           static_cast<uint32_t>( hex_color::YELLOW_PROCESS ) },
+        { "YELLOW_RYB",                               static_cast<uint32_t>( hex_color::YELLOW_RYB ) },
+        { "YELLOW_GREEN",                             static_cast<uint32_t>( hex_color::YELLOW_GREEN ) },
+        { "YELLOW_GREEN_CRAYOLA",                     static_cast<uint32_t>( hex_color::YELLOW_GREEN_CRAYOLA ) },
+        { "YELLOW_GREEN_COLOR_WHEEL",                 static_cast<uint32_t>( hex_color::YELLOW_GREEN_COLOR_WHEEL ) },
+        { "YELLOW_ORANGE",                            static_cast<uint32_t>( hex_color::YELLOW_ORANGE ) },
+        { "YELLOW_ORANGE_COLOR_WHEEL",                static_cast<uint32_t>( hex_color::YELLOW_ORANGE_COLOR_WHEEL ) },
+        { "YELLOW_SUNSHINE",                          static_cast<uint32_t>( hex_color::YELLOW_SUNSHINE ) },
+        { "YINMN_BLUE",                               static_cast<uint32_t>( hex_color::YINMN_BLUE ) },
+        { "ZAFFRE",                                   static_cast<uint32_t>( hex_color::ZAFFRE ) },
+        { "ZOMP",                                     static_cast<uint32_t>( hex_color::ZOMP ) },
+        { "PANTONE_448_C",                            static_cast<uint32_t>( hex_color::PANTONE_448_C ) }
+    } };
+
+    constexpr std::size_t color_count{ table.size() };
+
+    //   A contiguous run of ids inside one of the precomputed indexes.  Never owns memory.
+    struct id_span
+    {
+        const color_id* first{ nullptr };
+        const color_id* last{ nullptr };
+
+        constexpr const color_id* begin() const { return first; }
+        constexpr const color_id* end() const   { return last; }
+        constexpr std::size_t size() const      { return static_cast<std::size_t>( last - first ); }
+        constexpr bool empty() const            { return first == last; }
+        constexpr color_id operator[]( std::size_t i ) const { return first[i]; }
+    };
+
+
+
+    constexpr uint8_t red( uint32_t color )   { return static_cast<uint8_t>( color >> 24 ); }
+    constexpr uint8_t green( uint32_t color ) { return static_cast<uint8_t>( color >> 16 ); }
+    constexpr uint8_t blue( uint32_t color )  { return static_cast<uint8_t>( color >> 8 ); }
+    constexpr uint8_t alpha( uint32_t color ) { return static_cast<uint8_t>( color ); }
+
+    constexpr uint32_t rgba( uint8_t r, uint8_t g, uint8_t b, uint8_t a = 0xff )
+    {
+        return ( static_cast<uint32_t>( r ) << 24 ) | ( static_cast<uint32_t>( g ) << 16 ) |
+               ( static_cast<uint32_t>( b ) << 8 ) | a;
+    }
+
+    //   Squared euclidean distance between two colors in 8 bit sRGB, alpha ignored.  This is the metric used by
+    // nearest() and every search that has to agree with it.
+    constexpr uint32_t distance_squared( uint32_t lhs, uint32_t rhs )
+    {
+        const int dr{ red( lhs ) - red( rhs ) };
+        const int dg{ green( lhs ) - green( rhs ) };
+        const int db{ blue( lhs ) - blue( rhs ) };
+        return static_cast<uint32_t>( dr * dr + dg * dg + db * db );
+    }
+
+
+
+    namespace detail
+    {
+        //   Both lookup tables are open addressed with linear probing and built at compile time.  They are a little
+        // over twice the size of the color table so probe sequences stay short.
+        constexpr std::size_t slot_count{ 2048 };
+        constexpr std::size_t slot_mask{ slot_count - 1 };
+
+        constexpr uint32_t hash_name( std::string_view name )
+        {
+            uint32_t hash{ 0x81'1C'9D'C5 };
+            for( const char c : name )
+            {
+                hash ^= static_cast<uint8_t>( c );
+                hash *= 0x01'00'01'93;
+            }
+            return hash;
+        }
+
+        constexpr uint32_t hash_value( uint32_t color )
+        {
+            return ( ( color >> 8 ) * 0x9E'37'79'B1 ) >> 21;
+        }
+
+        constexpr std::array<color_id, slot_count> make_name_slots()
+        {
+            std::array<color_id, slot_count> slots{};
+            for( auto& slot : slots )
+            {
+                slot = no_color;
+            }
+            for( std::size_t id{ 0 }; id < table.size(); ++id )
+            {
+                auto slot{ hash_name( table[id].name ) & slot_mask };
+                while( slots[slot] != no_color )
+                {
+                    slot = ( slot + 1 ) & slot_mask;
+                }
+                slots[slot] = static_cast<color_id>( id );
+            }
+            return slots;
+        }
+
+        //   Only the first id with a given value is inserted so that reverse lookups return the first alias.
+        constexpr std::array<color_id, slot_count> make_value_slots()
+        {
+            std::array<color_id, slot_count> slots{};
+            for( auto& slot : slots )
+            {
+                slot = no_color;
+            }
+            for( std::size_t id{ 0 }; id < table.size(); ++id )
+            {
+                auto slot{ hash_value( table[id].value ) & slot_mask };
+                while( slots[slot] != no_color && ( table[slots[slot]].value >> 8 ) != ( table[id].value >> 8 ) )
+                {
+                    slot = ( slot + 1 ) & slot_mask;
+                }
+                if( slots[slot] == no_color )
+                {
+                    slots[slot] = static_cast<color_id>( id );
+                }
+            }
+            return slots;
+        }
+
+        //   Heap sort of ids, usable in constant expressions (std::sort isn't constexpr until C++20).  less must be a
+        // strict weak order; ties should be broken by id to keep indexes deterministic.
+        template<std::size_t N, typename Less>
+        constexpr void sort_ids( std::array<color_id, N>& ids, Less less )
+        {
+            const auto sift_down{ [&ids, &less]( std::size_t root, std::size_t end )
+            {
+                while( 2 * root + 1 < end )
+                {
+                    std::size_t child{ 2 * root + 1 };
+                    if( child + 1 < end && less( ids[child], ids[child + 1] ) )
+                    {
+                        ++child;
+                    }
+                    if( !less( ids[root], ids[child] ) )
+                    {
+                        return;
+                    }
+                    const auto swapped{ ids[root] };
+                    ids[root] = ids[child];
+                    ids[child] = swapped;
+                    root = child;
+                }
+            } };
+
+            for( std::size_t start{ N / 2 }; start-- > 0; )
+            {
+                sift_down( start, N );
+            }
+            for( std::size_t end{ N }; end-- > 1; )
+            {
+                const auto swapped{ ids[0] };
+                ids[0] = ids[end];
+                ids[end] = swapped;
+                sift_down( 0, end );
+            }
+        }
+
+        inline constexpr auto name_slots{ make_name_slots() };
+        inline constexpr auto value_slots{ make_value_slots() };
+
+        //   Slots a failed lookup starting at start looks at, including the empty one that ends it.
+        template<typename Slots>
+        constexpr std::size_t probe_length( const Slots& slots, std::size_t start )
+        {
+            std::size_t length{ 1 };
+            for( auto slot{ start }; slots[slot] != no_color; slot = ( slot + 1 ) & slot_mask )
+            {
+                ++length;
+            }
+            return length;
+        }
+    }
+
+
+
+    //   Name to id, e.g. find( "NAVY_BLUE" ).  Names are exactly as spelled in hex_color.
+    constexpr color_id find( std::string_view name )
+    {
+        NAMED_COLORS_COUNT( find_calls, 1 );
+        const auto start{ detail::hash_name( name ) & detail::slot_mask };
+        for( auto slot{ start }; detail::name_slots[slot] != no_color; slot = ( slot + 1 ) & detail::slot_mask )
+        {
+            if( table[detail::name_slots[slot]].name == name )
+            {
+                NAMED_COLORS_COUNT( find_probes, ( ( slot - start ) & detail::slot_mask ) + 1 );
+                return detail::name_slots[slot];
+            }
+        }
+        NAMED_COLORS_COUNT( find_probes, detail::probe_length( detail::name_slots, start ) );
+        return no_color;
+    }
+
+    //   Value to the id of the first color with exactly that value.
+    constexpr color_id id_of( uint32_t color )
+    {
+        NAMED_COLORS_COUNT( id_of_calls, 1 );
+        const auto start{ detail::hash_value( color ) & detail::slot_mask };
+        for( auto slot{ start }; detail::value_slots[slot] != no_color; slot = ( slot + 1 ) & detail::slot_mask )
+        {
+            if( ( table[detail::value_slots[slot]].value >> 8 ) == ( color >> 8 ) )
+            {
+                NAMED_COLORS_COUNT( id_of_probes, ( ( slot - start ) & detail::slot_mask ) + 1 );
+                return detail::value_slots[slot];
+            }
+        }
+        NAMED_COLORS_COUNT( id_of_probes, detail::probe_length( detail::value_slots, start ) );
+        return no_color;
+    }
+
+    //   Value to name.  Empty if the value isn't a named color.
+    constexpr std::string_view name_of( uint32_t color )
+    {
+        const auto id{ id_of( color ) };
+        return id == no_color ? std::string_view{} : table[id].name;
+    }
+
+
+
+    //   Canonical ids.  Aliases share a value, so a search only needs to look at one id per value: the id of the
+    // first alias, which is also what id_of() returns.  canonical_ids lists those in id order and canonical_values
+    // holds their values, contiguously, for the search loops.  The search structures in this header and the
+    // companion headers are all built over canonical ids; aliases() gives back the other names.
+    namespace detail
+    {
+        constexpr std::size_t count_canonical()
+        {
+            std::size_t count{ 0 };
+            for( std::size_t id{ 0 }; id < table.size(); ++id )
+            {
+                count += id_of( table[id].value ) == id;
+            }
+            return count;
+        }
+    }
+
+    constexpr std::size_t canonical_count{ detail::count_canonical() };
+
+    //   Fraction of the table left after removing aliases.
+    constexpr double dedup_ratio{ static_cast<double>( canonical_count ) / static_cast<double>( color_count ) };
+
+    namespace detail
+    {
+        struct alias_groups
+        {
+            std::array<color_id, canonical_count>     ids{};
+            std::array<uint32_t, canonical_count>     values{};
+            std::array<uint16_t, color_count>         group{};        //  Position in ids of every id's value.
+            std::array<uint16_t, canonical_count + 1> starts{};       //  Where each group begins in members.
+            std::array<color_id, color_count>         members{};      //  All ids, grouped by value, in id order.
+        };
+
+        constexpr alias_groups make_alias_groups()
+        {
+            alias_groups groups{};
+            std::size_t count{ 0 };
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                const auto first{ id_of( table[id].value ) };
+                if( first == id )
+                {
+                    groups.ids[count] = first;
+                    groups.values[count] = table[id].value;
+                    groups.group[id] = static_cast<uint16_t>( count++ );
+                }
+                else
+                {
+                    groups.group[id] = groups.group[first];
+                }
+                ++groups.starts[groups.group[id] + 1];
+            }
+            for( std::size_t i{ 0 }; i < canonical_count; ++i )
+            {
+                groups.starts[i + 1] = static_cast<uint16_t>( groups.starts[i + 1] + groups.starts[i] );
+            }
+            auto next{ groups.starts };
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                groups.members[next[groups.group[id]]++] = static_cast<color_id>( id );
+            }
+            return groups;
+        }
+
+        inline constexpr alias_groups aliases{ make_alias_groups() };
+    }
+
+    inline constexpr const std::array<color_id, canonical_count>& canonical_ids{ detail::aliases.ids };
+    inline constexpr const std::array<uint32_t, canonical_count>& canonical_values{ detail::aliases.values };
+
+    //   Position of id's value in canonical_ids and canonical_values.
+    constexpr std::size_t canonical_index( color_id id )
+    {
+        return detail::aliases.group[id];
+    }
+
+    constexpr color_id canonical_id( color_id id )
+    {
+        return canonical_ids[canonical_index( id )];
+    }
+
+    constexpr bool is_canonical( color_id id )
+    {
+        return canonical_id( id ) == id;
+    }
+
+    namespace detail
+    {
+        constexpr uint64_t make_table_hash()
+        {
+            uint64_t hash{ 0xCB'F2'9C'E4'84'22'23'25 };
+            for( const auto& e : table )
+            {
+                for( int shift{ 24 }; shift >= 0; shift -= 8 )
+                {
+                    hash ^= static_cast<uint8_t>( e.value >> shift );
+                    hash *= 0x00'00'01'00'00'00'01'B3;
+                }
+            }
+            return hash;
+        }
+    }
+
+    //   64 bit FNV-1a of every value in id order.  Anything that stores or sends color_ids compares it to tell
+    // whether the other side was built from the same table: ids, canonical ids and canonical values only mean the
+    // same colors if the values and their order are the same.
+    inline constexpr uint64_t table_hash{ detail::make_table_hash() };
+
+    //   Every id with the same value as id, including id itself, in id order.
+    constexpr id_span aliases( color_id id )
+    {
+        const auto group{ canonical_index( id ) };
+        return { detail::aliases.members.data() + detail::aliases.starts[group],
+                 detail::aliases.members.data() + detail::aliases.starts[group + 1] };
+    }
+
+
+
+    //   Compact storage.  Every named color has an alpha of 0xff, so a quarter of every 0xRRGGBBAA value is dead
+    // weight.  The search loops read the canonical values from three planar byte arrays instead, which are 2.6 KB
+    // rather than 3.5 KB and can be loaded a vector of channels at a time.  rgb24 is the packed 3 byte form for
+    // callers who store colors themselves; narrow() and widen() convert to and from 0xRRGGBBAA.
+    struct rgb24
+    {
+        uint8_t r;
+        uint8_t g;
+        uint8_t b;
+    };
+    static_assert( sizeof( rgb24 ) == 3 );
+
+    constexpr rgb24 narrow( uint32_t color )
+    {
+        return { red( color ), green( color ), blue( color ) };
+    }
+
+    constexpr uint32_t widen( rgb24 color, uint8_t a = 0xff )
+    {
+        return rgba( color.r, color.g, color.b, a );
+    }
+
+    struct rgb_planes
+    {
+        alignas( 32 ) std::array<uint8_t, canonical_count> r;
+        alignas( 32 ) std::array<uint8_t, canonical_count> g;
+        alignas( 32 ) std::array<uint8_t, canonical_count> b;
+
+        constexpr uint32_t widen( std::size_t i, uint8_t a = 0xff ) const
+        {
+            return rgba( r[i], g[i], b[i], a );
+        }
+    };
+
+    namespace detail
+    {
+        constexpr rgb_planes make_canonical_rgb()
+        {
+            rgb_planes planes{};
+            for( std::size_t i{ 0 }; i < canonical_count; ++i )
+            {
+                planes.r[i] = red( canonical_values[i] );
+                planes.g[i] = green( canonical_values[i] );
+                planes.b[i] = blue( canonical_values[i] );
+            }
+            return planes;
+        }
+    }
+
+    //   canonical_values split into channels, indexed like canonical_ids.
+    inline constexpr rgb_planes canonical_rgb{ detail::make_canonical_rgb() };
+
+
+
+    //   Id of the named color closest to color by distance_squared().  Ties go to the lowest id, so the result is
+    // always a canonical id.  This is the plain scalar reference search.
+    constexpr color_id nearest( uint32_t color )
+    {
+        NAMED_COLORS_COUNT( nearest_calls, 1 );
+        NAMED_COLORS_COUNT( nearest_candidates, canonical_count );
+        const int r{ red( color ) };
+        const int g{ green( color ) };
+        const int b{ blue( color ) };
+        std::size_t best{ 0 };
+        int best_distance{ 3 * 255 * 255 + 1 };
+        for( std::size_t i{ 0 }; i < canonical_count; ++i )
+        {
+            const int dr{ canonical_rgb.r[i] - r };
+            const int dg{ canonical_rgb.g[i] - g };
+            const int db{ canonical_rgb.b[i] - b };
+            const int distance{ dr * dr + dg * dg + db * db };
+            if( distance < best_distance )
+            {
+                best = i;
+                best_distance = distance;
+            }
+        }
+        return canonical_ids[best];
+    }
+
+    namespace detail
+    {
+        //   The bulk nearest color search.  load( i ) returns the i'th color as 0xRRGGBBAA.  Colors are taken a
+        // block at a time and each named color is compared with the whole block, so the inner loop runs across
+        // colors with no branches and vectorizes.
+        template<typename Load>
+        void nearest_blocks( std::size_t count, Load load, color_id* ids )
+        {
+            NAMED_COLORS_COUNT( nearest_batches, 1 );
+            NAMED_COLORS_COUNT( nearest_items, count );
+            NAMED_COLORS_COUNT( nearest_candidates, count * canonical_count );
+            NAMED_COLORS_COUNT_BATCH( count );
+            constexpr std::size_t block{ 64 };
+            alignas( 32 ) int32_t r[block];
+            alignas( 32 ) int32_t g[block];
+            alignas( 32 ) int32_t b[block];
+            alignas( 32 ) int32_t best_distance[block];
+            alignas( 32 ) int32_t best[block];
+            for( std::size_t first{ 0 }; first < count; first += block )
+            {
+                const std::size_t n{ count - first < block ? count - first : block };
+                for( std::size_t i{ 0 }; i < block; ++i )
+                {
+                    const uint32_t color{ i < n ? load( first + i ) : 0 };
+                    r[i] = red( color );
+                    g[i] = green( color );
+                    b[i] = blue( color );
+                    best_distance[i] = 3 * 255 * 255 + 1;
+                    best[i] = 0;
+                }
+                for( std::size_t c{ 0 }; c < canonical_count; ++c )
+                {
+                    const int32_t cr{ canonical_rgb.r[c] };
+                    const int32_t cg{ canonical_rgb.g[c] };
+                    const int32_t cb{ canonical_rgb.b[c] };
+                    for( std::size_t i{ 0 }; i < block; ++i )
+                    {
+                        const int32_t dr{ r[i] - cr };
+                        const int32_t dg{ g[i] - cg };
+                        const int32_t db{ b[i] - cb };
+                        const int32_t distance{ dr * dr + dg * dg + db * db };
+                        const bool closer{ distance < best_distance[i] };
+                        best_distance[i] = closer ? distance : best_distance[i];
+                        best[i] = closer ? static_cast<int32_t>( c ) : best[i];
+                    }
+                }
+                for( std::size_t i{ 0 }; i < n; ++i )
+                {
+                    ids[first + i] = canonical_ids[static_cast<std::size_t>( best[i] )];
+                }
+            }
+        }
+    }
+
+    //   Same results as calling nearest() on each color.
+    inline void nearest( const uint32_t* colors, std::size_t count, color_id* ids )
+    {
+        detail::nearest_blocks( count, [colors]( std::size_t i ) { return colors[i]; }, ids );
+    }
+
+    //   Same, for count pixels of interleaved 8 bit channels as image files store them: R, G, B bytes, followed by
+    // alpha when channels is 4.
+    inline void nearest( const uint8_t* pixels, std::size_t count, std::size_t channels, color_id* ids )
+    {
+        detail::nearest_blocks( count, [pixels, channels]( std::size_t i )
+        {
+            const uint8_t* p{ pixels + i * channels };
+            return rgba( p[0], p[1], p[2] );
+        }, ids );
+    }
+
+    //   Bulk version of from_hex(), writing count * 4 normalized floats in R, G, B, A order.
+    inline void to_float4( const uint32_t* colors, std::size_t count, float* rgba )
+    {
+        constexpr float scale{ 1.0f / 255.0f };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            rgba[i * 4 + 0] = static_cast<float>( red( colors[i] ) ) * scale;
+            rgba[i * 4 + 1] = static_cast<float>( green( colors[i] ) ) * scale;
+            rgba[i * 4 + 2] = static_cast<float>( blue( colors[i] ) ) * scale;
+            rgba[i * 4 + 3] = static_cast<float>( alpha( colors[i] ) ) * scale;
+        }
+    }
+}
@@ -0,0 +1,265 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  CIE XYZ, xyY chromaticity and correlated color temperature (CCT) with its
+// distance from the Planckian locus (Duv) for every named color, computed at compile time, and an index of the
+// near white colors sorted by CCT, for lighting tools that pick colors by temperature:
+//
+//      const auto tungsten{ named_colors::nearest_cct( 3200.0 ) };
+//      for( const auto id : named_colors::cct_range( 2700.0, 3500.0 ) ) ...
+//
+//   CCT is the temperature of the point on the Planckian locus closest to the color in the CIE 1960 uv diagram.  The
+// locus is Krystek's (1985) rational approximation, good to about 1 K from 1000 K to 15000 K, and the closest point
+// is found with a coarse scan in mireds refined by a ternary search.  Duv is the distance from that point, positive
+// above the locus (greener) and negative below it (pinker).
+//
+//   A CCT only means something for colors near the locus and with some light to them, so the index holds the
+// canonical ids with |Duv| of at most max_cct_duv, a CCT inside the locus approximation's range and a luminance of
+// at least min_cct_luminance; cct_table has a value for every color regardless.  Black has no chromaticity; its xyY
+// takes the D65 white point's, as is usual, and black and the darkest grays are left out of the index.  Every
+// neutral gray has the white point's chromaticity too, so all of them collapse to the same CCT, about 6505 K.
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_math.h"
+#include "named_colors_table.h"
+
+#include<algorithm>
+#include<array>
+#include<cstddef>
+#include<cstdint>
+
+
+
+namespace named_colors
+{
+    //   Chromaticity x, y and luminance Y, with Y of white 1.
+    struct xyy
+    {
+        double x;
+        double y;
+        double luminance;
+    };
+
+    struct cct_duv
+    {
+        double cct;     //  Kelvin.
+        double duv;
+    };
+
+    constexpr double min_cct{ 1000.0 };
+    constexpr double max_cct{ 15000.0 };
+    constexpr double max_cct_duv{ 0.05 };
+    constexpr double min_cct_luminance{ 0.02 };
+
+    constexpr xyy to_xyy( const xyz& c )
+    {
+        const double sum{ c.x + c.y + c.z };
+        if( sum <= 0.0 )
+        {
+            return { 0.3127, 0.3290, 0.0 };
+        }
+        return { c.x / sum, c.y / sum, c.y };
+    }
+
+    namespace detail
+    {
+        struct uv
+        {
+            double u;
+            double v;
+        };
+
+        constexpr uv to_uv( const xyy& c )
+        {
+            const double d{ -2.0 * c.x + 12.0 * c.y + 3.0 };
+            return { 4.0 * c.x / d, 6.0 * c.y / d };
+        }
+
+        //   Krystek's approximation of the Planckian locus in CIE 1960 uv.
+        constexpr uv planckian( double kelvin )
+        {
+            const double t{ kelvin };
+            return {
+                ( 0.860117757 + 1.54118254e-4 * t + 1.28641212e-7 * t * t ) / ( 1.0 + 8.42420235e-4 * t + 7.08145163e-7 * t * t ),
+                ( 0.317398726 + 4.22806245e-5 * t + 4.20481691e-8 * t * t ) / ( 1.0 - 2.89741816e-5 * t + 1.61456053e-7 * t * t ) };
+        }
+
+        constexpr double locus_distance_squared( const uv& c, double mired )
+        {
+            const auto p{ planckian( 1.0e6 / mired ) };
+            return ( c.u - p.u ) * ( c.u - p.u ) + ( c.v - p.v ) * ( c.v - p.v );
+        }
+    }
+
+    //   CCT is clamped to [min_cct, max_cct].
+    constexpr cct_duv to_cct( const xyy& c )
+    {
+        const auto point{ detail::to_uv( c ) };
+
+        //   Mireds are close to evenly spaced along the locus, so the scan steps are too.
+        constexpr double low{ 1.0e6 / max_cct };
+        constexpr double high{ 1.0e6 / min_cct };
+        constexpr int steps{ 64 };
+        constexpr double step{ ( high - low ) / steps };
+        int best{ 0 };
+        for( int i{ 1 }; i <= steps; ++i )
+        {
+            if( detail::locus_distance_squared( point, low + i * step ) < detail::locus_distance_squared( point, low + best * step ) )
+            {
+                best = i;
+            }
+        }
+
+        double from{ best > 0 ? low + ( best - 1 ) * step : low };
+        double to{ best < steps ? low + ( best + 1 ) * step : high };
+        for( int i{ 0 }; i < 60; ++i )
+        {
+            const double a{ from + ( to - from ) / 3.0 };
+            const double b{ to - ( to - from ) / 3.0 };
+            if( detail::locus_distance_squared( point, a ) < detail::locus_distance_squared( point, b ) )
+            {
+                to = b;
+            }
+            else
+            {
+                from = a;
+            }
+        }
+
+        const double kelvin{ 1.0e6 / ( 0.5 * ( from + to ) ) };
+        const auto locus{ detail::planckian( kelvin ) };
+        const double distance{ detail::sqrt( detail::locus_distance_squared( point, 1.0e6 / kelvin ) ) };
+        return { kelvin, point.v >= locus.v ? distance : -distance };
+    }
+
+    constexpr cct_duv to_cct( uint32_t color )
+    {
+        return to_cct( to_xyy( to_xyz( color ) ) );
+    }
+
+
+
+    namespace detail
+    {
+        template<typename T, typename Convert>
+        constexpr std::array<T, color_count> make_color_table( Convert convert )
+        {
+            std::array<T, color_count> values{};
+            for( std::size_t id{ 0 }; id < color_count; ++id )
+            {
+                values[id] = convert( table[id].value );
+            }
+            return values;
+        }
+    }
+
+    //   to_xyz(), to_xyy() and to_cct() of every named color, indexed by color_id.
+    inline constexpr std::array<xyz, color_count> xyz_table{ detail::make_color_table<xyz>( []( uint32_t c ) { return to_xyz( c ); } ) };
+    inline constexpr std::array<xyy, color_count> xyy_table{ detail::make_color_table<xyy>( []( uint32_t c ) { return to_xyy( to_xyz( c ) ); } ) };
+    inline constexpr std::array<cct_duv, color_count> cct_table{ detail::make_color_table<cct_duv>( []( uint32_t c ) { return to_cct( c ); } ) };
+
+    namespace detail
+    {
+        //   Clamped CCTs are outside the locus approximation, and colors darker than the floor (black in
+        // particular, whose chromaticity is made up) aren't lights, so neither count.
+        constexpr bool has_cct( color_id id )
+        {
+            const auto& c{ cct_table[id] };
+            return c.duv <= max_cct_duv && c.duv >= -max_cct_duv && c.cct > min_cct * 1.0001 && c.cct < max_cct * 0.9999 &&
+                   xyy_table[id].luminance >= min_cct_luminance;
+        }
+
+        constexpr std::size_t count_cct()
+        {
+            std::size_t count{ 0 };
+            for( const auto id : canonical_ids )
+            {
+                count += has_cct( id );
+            }
+            return count;
+        }
+
+        constexpr std::size_t cct_count{ count_cct() };
+
+        constexpr std::array<color_id, cct_count> make_cct_order()
+        {
+            std::array<color_id, cct_count> ids{};
+            std::size_t count{ 0 };
+            for( const auto id : canonical_ids )
+            {
+                if( has_cct( id ) )
+                {
+                    ids[count++] = id;
+                }
+            }
+            sort_ids( ids, []( color_id lhs, color_id rhs )
+            {
+                return cct_table[lhs].cct < cct_table[rhs].cct || ( cct_table[lhs].cct == cct_table[rhs].cct && lhs < rhs );
+            } );
+            return ids;
+        }
+
+        constexpr std::array<double, cct_count> make_sorted_cct( const std::array<color_id, cct_count>& order )
+        {
+            std::array<double, cct_count> keys{};
+            for( std::size_t i{ 0 }; i < cct_count; ++i )
+            {
+                keys[i] = cct_table[order[i]].cct;
+            }
+            return keys;
+        }
+
+        inline constexpr auto cct_order{ make_cct_order() };
+
+        //   The CCTs in index order, so the binary searches only touch one contiguous array.
+        inline constexpr auto sorted_cct{ make_sorted_cct( cct_order ) };
+    }
+
+    //   The indexed colors, coolest (lowest CCT) first.
+    constexpr id_span cct_index()
+    {
+        return { detail::cct_order.data(), detail::cct_order.data() + detail::cct_count };
+    }
+
+    //   Indexed colors with a CCT from min to max kelvin inclusive, lowest CCT first.
+    inline id_span cct_range( double min, double max )
+    {
+        if( !( min <= max ) )
+        {
+            return {};
+        }
+        const auto& keys{ detail::sorted_cct };
+        const auto first{ std::lower_bound( keys.begin(), keys.end(), min ) };
+        const auto last{ std::upper_bound( first, keys.end(), max ) };
+        return { detail::cct_order.data() + ( first - keys.begin() ), detail::cct_order.data() + ( last - keys.begin() ) };
+    }
+
+    //   Indexed color whose CCT is closest to kelvin, measured in mireds as lighting does, so 100 K matters more at
+    // 2700 K than at 6500 K.  Ties go to the lower CCT.
+    inline color_id nearest_cct( double kelvin )
+    {
+        const auto& keys{ detail::sorted_cct };
+        if( keys.empty() || !( kelvin > 0.0 ) )
+        {
+            return no_color;
+        }
+        const auto above{ std::lower_bound( keys.begin(), keys.end(), kelvin ) };
+        if( above == keys.begin() )
+        {
+            return detail::cct_order.front();
+        }
+        if( above == keys.end() )
+        {
+            return detail::cct_order.back();
+        }
+        const auto below{ above - 1 };
+        const double mired{ 1.0e6 / kelvin };
+        const bool lower{ 1.0e6 / *below - mired <= mired - 1.0e6 / *above };
+        return detail::cct_order[static_cast<std::size_t>( ( lower ? below : above ) - keys.begin() )];
+    }
+}
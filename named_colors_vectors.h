@@ -0,0 +1,96 @@
+#pragma once
+
+
+//
+//   Companion to named_colors.h.  Named colors as the vector types math code actually uses, instead of the
+// std::tuple<double, double, double, double> of NAMED_COLORS_ENABLE_TUPLES that has to be unpacked field by field.
+//
+//   Every version reads from gpu_palette (or gpu_palette_linear) in named_colors_gpu.h, a compile time array of
+// 16 byte aligned float4, so a color is one aligned 16 byte load whatever type it ends up in and there is only one
+// copy of the data.  rgba32f is always available.  The others are opt-in since they need their libraries:
+//
+//   +-----------------------------+--------------------------------------+------------------------------------+
+//   | Define                      | Provides                             | Needs                              |
+//   +-----------------------------+--------------------------------------+------------------------------------+
+//   | NAMED_COLORS_ENABLE_GLM     | glm::vec4 as_glm( id )               | <glm/vec4.hpp>                     |
+//   | NAMED_COLORS_ENABLE_EIGEN   | Eigen::Vector4f as_eigen( id ),      | <Eigen/Core>                       |
+//   |                             | eigen_palette() (4 x N, no copy)     |                                    |
+//   | NAMED_COLORS_ENABLE_SSE     | __m128 as_m128( id )                 | SSE, i.e. any x86-64 compiler      |
+//   +-----------------------------+--------------------------------------+------------------------------------+
+//
+//   All of them take a color_id.  For a color known at compile time gpu_index() gives one for free:
+//
+//      constexpr auto navy{ named_colors::gpu_index( hex_color::NAVY_BLUE ) };
+//      const __m128 color{ named_colors::as_m128( navy ) };
+//
+//   Requires C++17.
+//
+
+
+
+#include "named_colors_gpu.h"
+#include "named_colors_table.h"
+
+#include<cstddef>
+#include<cstdint>
+
+#if defined(NAMED_COLORS_ENABLE_GLM)
+#   include<glm/vec4.hpp>
+#endif
+
+#if defined(NAMED_COLORS_ENABLE_EIGEN)
+#   include<Eigen/Core>
+#endif
+
+#if defined(NAMED_COLORS_ENABLE_SSE)
+#   include<xmmintrin.h>
+#endif
+
+
+
+namespace named_colors
+{
+    //   Plain 16 byte aligned R, G, B, A floats.
+    using rgba32f = float4;
+
+    //   What the channels of a vector hold.
+    enum class vector_encoding
+    {
+        srgb,       //  Normalized sRGB, the same values as from_hex().
+        linear      //  Linear RGB, alpha unchanged.
+    };
+
+    constexpr const rgba32f& as_rgba32f( color_id id, vector_encoding encoding = vector_encoding::srgb )
+    {
+        return encoding == vector_encoding::srgb ? gpu_palette[id] : gpu_palette_linear[id];
+    }
+
+#if defined(NAMED_COLORS_ENABLE_GLM)
+    inline glm::vec4 as_glm( color_id id, vector_encoding encoding = vector_encoding::srgb )
+    {
+        const auto& c{ as_rgba32f( id, encoding ) };
+        return glm::vec4{ c.r, c.g, c.b, c.a };
+    }
+#endif
+
+#if defined(NAMED_COLORS_ENABLE_EIGEN)
+    inline Eigen::Vector4f as_eigen( color_id id, vector_encoding encoding = vector_encoding::srgb )
+    {
+        return Eigen::Map<const Eigen::Vector4f, Eigen::Aligned16>{ &as_rgba32f( id, encoding ).r };
+    }
+
+    //   The whole palette as a 4 x color_count matrix, one column per color_id, without copying it.
+    inline Eigen::Map<const Eigen::Matrix<float, 4, Eigen::Dynamic>, Eigen::Aligned16> eigen_palette( vector_encoding encoding = vector_encoding::srgb )
+    {
+        const auto& palette{ encoding == vector_encoding::srgb ? gpu_palette : gpu_palette_linear };
+        return { &palette[0].r, 4, static_cast<Eigen::Index>( color_count ) };
+    }
+#endif
+
+#if defined(NAMED_COLORS_ENABLE_SSE)
+    inline __m128 as_m128( color_id id, vector_encoding encoding = vector_encoding::srgb )
+    {
+        return _mm_load_ps( &as_rgba32f( id, encoding ).r );
+    }
+#endif
+}
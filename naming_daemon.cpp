@@ -0,0 +1,425 @@
+//
+//   Serves named color queries to other processes over a Unix domain socket, so that they don't each need their
+// own copy of the lookup structures.  named_colors_client.h has the protocol and the client.
+//
+//   Requests from every client that are waiting when the daemon wakes up are answered together: all of their
+// nearest color queries are gathered into one array and go through a single call of the bulk, vectorized
+// named_colors::nearest().  On SIGINT or SIGTERM it prints how many requests it answered in how many batches.
+//
+//   Usage:  naming_daemon [SOCKET]        (default /tmp/named_colors.sock)
+//
+// This file requires C++17 and POSIX.
+//
+
+
+#include "named_colors_client.h"
+#include "named_colors_table.h"
+
+
+
+#include<algorithm>
+#include<cerrno>
+#include<csignal>
+#include<cstddef>
+#include<cstdint>
+#include<cstdio>
+#include<cstring>
+#include<string_view>
+#include<vector>
+
+#include<fcntl.h>
+#include<poll.h>
+#include<sys/socket.h>
+#include<sys/un.h>
+#include<unistd.h>
+
+
+
+namespace
+{
+    using namespace named_colors;
+
+    volatile std::sig_atomic_t stopping{ 0 };
+
+    //   A client's buffers are capped so one that sends without reading can't make the daemon grow without limit.
+    // Input holds at least the largest frame.  Once a client's unsent answers pass max_output, the daemon stops
+    // reading and answering its requests until it has taken them, and the kernel's socket buffer holds it back.
+    constexpr std::size_t max_input{ sizeof( naming::frame_header ) + naming::max_payload };
+    constexpr std::size_t max_output{ 1 << 20 };
+
+    struct connection
+    {
+        int               fd;
+        std::vector<char> in;
+        std::vector<char> out;
+        bool              closed{ false };
+
+        bool backed_up() const { return out.size() >= max_output; }
+    };
+
+    //   A complete request frame still sitting in its connection's input buffer.
+    struct request
+    {
+        std::size_t          client;
+        naming::frame_header header;
+        std::size_t          payload;    //  Offset of the payload in the input buffer.
+    };
+
+    bool set_nonblocking( int fd )
+    {
+        const int flags{ ::fcntl( fd, F_GETFL ) };
+        return flags >= 0 && ::fcntl( fd, F_SETFL, flags | O_NONBLOCK ) == 0;
+    }
+
+    //   Checks that the payload holds exactly header.count items of the kind the operation expects.
+    bool valid( const naming::frame_header& header, const char* payload )
+    {
+        switch( header.op )
+        {
+        case naming::operation::hello:
+            return header.size == 0 && header.count == 0;
+        case naming::operation::name_of:
+        case naming::operation::nearest:
+            return header.size == header.count * sizeof( uint32_t );
+        case naming::operation::find:
+        {
+            std::size_t offset{ 0 };
+            for( std::size_t i{ 0 }; i < header.count; ++i )
+            {
+                if( offset >= header.size )
+                {
+                    return false;
+                }
+                offset += 1 + static_cast<uint8_t>( payload[offset] );
+            }
+            return offset == header.size;
+        }
+        default:
+            return false;
+        }
+    }
+
+    class naming_server
+    {
+    public:
+        explicit naming_server( int listener ) : listener_( listener ) {}
+
+        void run()
+        {
+            std::vector<pollfd> fds;
+            while( !stopping )
+            {
+                fds.assign( 1, { listener_, POLLIN, 0 } );
+                for( const auto& c : clients_ )
+                {
+                    const bool reading{ !c.backed_up() && c.in.size() < max_input };
+                    fds.push_back( { c.fd, static_cast<short>( ( reading ? POLLIN : 0 ) | ( c.out.empty() ? 0 : POLLOUT ) ), 0 } );
+                }
+                if( ::poll( fds.data(), fds.size(), -1 ) < 0 )
+                {
+                    if( errno == EINTR )
+                    {
+                        continue;
+                    }
+                    std::perror( "naming_daemon: poll" );
+                    return;
+                }
+
+                for( std::size_t i{ 0 }; i < clients_.size(); ++i )
+                {
+                    if( fds[i + 1].revents & POLLIN )
+                    {
+                        receive( clients_[i] );
+                    }
+                    else if( fds[i + 1].revents & ( POLLHUP | POLLERR ) )
+                    {
+                        //   Not being read, or there would have been POLLIN as well.
+                        clients_[i].closed = true;
+                    }
+                }
+                answer();
+                for( auto& c : clients_ )
+                {
+                    flush( c );
+                }
+                remove_closed();
+                if( fds[0].revents & POLLIN )
+                {
+                    accept();
+                }
+            }
+        }
+
+        void report() const
+        {
+            std::fprintf( stderr, "naming_daemon: %llu requests (%llu items) in %llu batches\n",
+                          static_cast<unsigned long long>( requests_ ), static_cast<unsigned long long>( items_ ),
+                          static_cast<unsigned long long>( batches_ ) );
+        }
+
+    private:
+        void accept()
+        {
+            for( ;; )
+            {
+                const int fd{ ::accept( listener_, nullptr, nullptr ) };
+                if( fd < 0 )
+                {
+                    return;
+                }
+                if( !set_nonblocking( fd ) )
+                {
+                    ::close( fd );
+                    continue;
+                }
+                clients_.push_back( { fd, {}, {} } );
+            }
+        }
+
+        static void receive( connection& c )
+        {
+            char buffer[65536];
+            while( c.in.size() < max_input )
+            {
+                const auto received{ ::recv( c.fd, buffer, std::min( sizeof( buffer ), max_input - c.in.size() ), 0 ) };
+                if( received > 0 )
+                {
+                    c.in.insert( c.in.end(), buffer, buffer + received );
+                    continue;
+                }
+                if( received == 0 || ( errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR ) )
+                {
+                    c.closed = true;
+                }
+                if( received == 0 || errno != EINTR )
+                {
+                    return;
+                }
+            }
+        }
+
+        static void flush( connection& c )
+        {
+            std::size_t sent{ 0 };
+            while( sent < c.out.size() )
+            {
+#if defined(MSG_NOSIGNAL)
+                const auto n{ ::send( c.fd, c.out.data() + sent, c.out.size() - sent, MSG_NOSIGNAL ) };
+#else
+                const auto n{ ::send( c.fd, c.out.data() + sent, c.out.size() - sent, 0 ) };
+#endif
+                if( n <= 0 )
+                {
+                    if( n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR )
+                    {
+                        c.closed = true;
+                    }
+                    if( n == 0 || errno != EINTR )
+                    {
+                        break;
+                    }
+                    continue;
+                }
+                sent += static_cast<std::size_t>( n );
+            }
+            c.out.erase( c.out.begin(), c.out.begin() + static_cast<std::ptrdiff_t>( sent ) );
+        }
+
+        void remove_closed()
+        {
+            std::size_t kept{ 0 };
+            for( auto& c : clients_ )
+            {
+                if( c.closed )
+                {
+                    ::close( c.fd );
+                }
+                else
+                {
+                    if( &clients_[kept] != &c )
+                    {
+                        clients_[kept] = static_cast<connection&&>( c );
+                    }
+                    ++kept;
+                }
+            }
+            clients_.resize( kept );
+        }
+
+        //   Answers every complete request of every client as one batch.
+        void answer()
+        {
+            pending_.clear();
+            colors_.clear();
+            consumed_.assign( clients_.size(), 0 );
+            std::size_t items{ 0 };
+            for( std::size_t i{ 0 }; i < clients_.size(); ++i )
+            {
+                auto& c{ clients_[i] };
+                std::size_t offset{ 0 };
+                std::size_t reply{ c.out.size() };      //  What the client's output will hold once this batch is answered.
+                while( !c.closed && reply < max_output && c.in.size() - offset >= sizeof( naming::frame_header ) )
+                {
+                    naming::frame_header header;
+                    std::memcpy( &header, c.in.data() + offset, sizeof( header ) );
+                    if( header.size > naming::max_payload )
+                    {
+                        c.closed = true;
+                        break;
+                    }
+                    if( c.in.size() - offset - sizeof( header ) < header.size )
+                    {
+                        break;
+                    }
+                    reply += sizeof( header ) + ( header.op == naming::operation::hello ? sizeof( naming::hello_reply )
+                                                                                          : header.count * sizeof( color_id ) );
+                    const std::size_t payload{ offset + sizeof( header ) };
+                    if( !valid( header, c.in.data() + payload ) )
+                    {
+                        header.result = naming::status::bad_request;
+                    }
+                    else if( header.op == naming::operation::nearest )
+                    {
+                        //   Only nearest queries are worth gathering; the other lookups are a hash probe each.
+                        const auto first{ colors_.size() };
+                        colors_.resize( first + header.count );
+                        std::memcpy( colors_.data() + first, c.in.data() + payload, header.size );
+                    }
+                    pending_.push_back( { i, header, payload } );
+                    items += header.count;
+                    offset = payload + header.size;
+                }
+                consumed_[i] = offset;
+            }
+            if( pending_.empty() )
+            {
+                return;
+            }
+
+            ids_.resize( colors_.size() );
+            nearest( colors_.data(), colors_.size(), ids_.data() );
+            ++batches_;
+            requests_ += pending_.size();
+            items_ += items;
+
+            std::size_t next_nearest{ 0 };
+            std::vector<color_id> answers;
+            for( const auto& r : pending_ )
+            {
+                auto& c{ clients_[r.client] };
+                const char* payload{ c.in.data() + r.payload };
+                auto header{ r.header };
+                answers.clear();
+                if( header.result == naming::status::ok )
+                {
+                    switch( header.op )
+                    {
+                    case naming::operation::hello:
+                        break;
+                    case naming::operation::find:
+                        for( std::size_t i{ 0 }, offset{ 0 }; i < header.count; ++i )
+                        {
+                            const auto length{ static_cast<uint8_t>( payload[offset] ) };
+                            answers.push_back( find( std::string_view{ payload + offset + 1, length } ) );
+                            offset += 1 + length;
+                        }
+                        break;
+                    case naming::operation::name_of:
+                        for( std::size_t i{ 0 }; i < header.count; ++i )
+                        {
+                            uint32_t color;
+                            std::memcpy( &color, payload + i * sizeof( color ), sizeof( color ) );
+                            answers.push_back( id_of( color ) );
+                        }
+                        break;
+                    default:
+                        answers.assign( ids_.begin() + static_cast<std::ptrdiff_t>( next_nearest ),
+                                        ids_.begin() + static_cast<std::ptrdiff_t>( next_nearest + header.count ) );
+                        next_nearest += header.count;
+                        break;
+                    }
+                }
+
+                if( header.op == naming::operation::hello && header.result == naming::status::ok )
+                {
+                    const naming::hello_reply hello{ naming::version, static_cast<uint32_t>( color_count ), table_hash };
+                    header.size = sizeof( hello );
+                    append( c.out, &header, sizeof( header ) );
+                    append( c.out, &hello, sizeof( hello ) );
+                }
+                else
+                {
+                    header.count = static_cast<uint16_t>( answers.size() );
+                    header.size = static_cast<uint32_t>( answers.size() * sizeof( color_id ) );
+                    append( c.out, &header, sizeof( header ) );
+                    append( c.out, answers.data(), header.size );
+                }
+            }
+
+            for( std::size_t i{ 0 }; i < clients_.size(); ++i )
+            {
+                clients_[i].in.erase( clients_[i].in.begin(), clients_[i].in.begin() + static_cast<std::ptrdiff_t>( consumed_[i] ) );
+            }
+        }
+
+        static void append( std::vector<char>& out, const void* data, std::size_t size )
+        {
+            const auto* bytes{ static_cast<const char*>( data ) };
+            out.insert( out.end(), bytes, bytes + size );
+        }
+
+        int                      listener_;
+        std::vector<connection>  clients_;
+        std::vector<request>     pending_;
+        std::vector<std::size_t> consumed_;     //  Bytes of each client's input answered by this batch.
+        std::vector<uint32_t>    colors_;       //  Nearest queries of the whole batch.
+        std::vector<color_id>    ids_;
+        uint64_t                 requests_{ 0 };
+        uint64_t                 items_{ 0 };
+        uint64_t                 batches_{ 0 };
+    };
+}
+
+
+
+int main( int argc, char** argv )
+{
+    if( argc > 2 )
+    {
+        std::fprintf( stderr, "usage: %s [SOCKET]\n", argv[0] );
+        return 2;
+    }
+    const char* path{ argc == 2 ? argv[1] : "/tmp/named_colors.sock" };
+
+    sockaddr_un address{};
+    if( std::strlen( path ) >= sizeof( address.sun_path ) )
+    {
+        std::fprintf( stderr, "%s: socket path too long\n", argv[0] );
+        return 1;
+    }
+    address.sun_family = AF_UNIX;
+    std::strcpy( address.sun_path, path );
+
+    const int listener{ ::socket( AF_UNIX, SOCK_STREAM, 0 ) };
+    ::unlink( path );
+    if( listener < 0 || ::bind( listener, reinterpret_cast<const sockaddr*>( &address ), sizeof( address ) ) != 0 ||
+        ::listen( listener, 128 ) != 0 || !set_nonblocking( listener ) )
+    {
+        std::fprintf( stderr, "%s: can't listen on %s: %s\n", argv[0], path, std::strerror( errno ) );
+        return 1;
+    }
+
+    struct sigaction action{};
+    action.sa_handler = []( int ) { stopping = 1; };
+    ::sigaction( SIGINT, &action, nullptr );
+    ::sigaction( SIGTERM, &action, nullptr );
+    std::signal( SIGPIPE, SIG_IGN );
+
+    naming_server server{ listener };
+    server.run();
+    server.report();
+
+    ::close( listener );
+    ::unlink( path );
+    return 0;
+}
@@ -0,0 +1,197 @@
+//
+//   Load generator for naming_daemon.cpp.  Starts a number of clients, each sending requests of random colors (or
+// names) back to back, checks the answers against the local table, and reports the median and 99th percentile
+// request latency and the overall throughput.
+//
+//   Usage:  naming_load [--socket PATH] [--clients N] [--requests N] [--batch N] [--op nearest|name_of|find]
+//
+// This file requires C++17 and POSIX.
+//
+
+
+#include "named_colors_client.h"
+#include "named_colors_table.h"
+
+
+
+#include<algorithm>
+#include<atomic>
+#include<chrono>
+#include<cstdint>
+#include<cstdio>
+#include<cstdlib>
+#include<string>
+#include<string_view>
+#include<thread>
+#include<vector>
+
+
+
+namespace
+{
+    using namespace named_colors;
+
+    struct options
+    {
+        std::string       socket{ "/tmp/named_colors.sock" };
+        std::size_t       clients{ 8 };
+        std::size_t       requests{ 2000 };
+        std::size_t       batch{ 64 };
+        naming::operation op{ naming::operation::nearest };
+    };
+
+    options parse( int argc, char** argv )
+    {
+        options opts;
+        for( int i{ 1 }; i < argc; ++i )
+        {
+            const std::string_view arg{ argv[i] };
+            const bool has_value{ i + 1 < argc };
+            if( arg == "--socket" && has_value )
+            {
+                opts.socket = argv[++i];
+            }
+            else if( arg == "--clients" && has_value )
+            {
+                opts.clients = std::max<std::size_t>( 1, std::strtoul( argv[++i], nullptr, 10 ) );
+            }
+            else if( arg == "--requests" && has_value )
+            {
+                opts.requests = std::max<std::size_t>( 1, std::strtoul( argv[++i], nullptr, 10 ) );
+            }
+            else if( arg == "--batch" && has_value )
+            {
+                opts.batch = std::clamp<std::size_t>( std::strtoul( argv[++i], nullptr, 10 ), 1, naming::max_items );
+            }
+            else if( arg == "--op" && has_value && ( argv[i + 1] == std::string_view{ "nearest" } ||
+                                                    argv[i + 1] == std::string_view{ "name_of" } ||
+                                                    argv[i + 1] == std::string_view{ "find" } ) )
+            {
+                const std::string_view op{ argv[++i] };
+                opts.op = op == "nearest" ? naming::operation::nearest : op == "name_of" ? naming::operation::name_of : naming::operation::find;
+            }
+            else
+            {
+                std::fprintf( stderr, "usage: %s [--socket PATH] [--clients N] [--requests N] [--batch N] [--op nearest|name_of|find]\n", argv[0] );
+                std::exit( 2 );
+            }
+        }
+        return opts;
+    }
+
+    //   splitmix64, so runs are repeatable.
+    struct generator
+    {
+        uint64_t state;
+
+        uint64_t next()
+        {
+            uint64_t z{ state += 0x9E'37'79'B9'7F'4A'7C'15 };
+            z = ( z ^ ( z >> 30 ) ) * 0xBF'58'47'6D'1C'E4'E5'B9;
+            z = ( z ^ ( z >> 27 ) ) * 0x94'D0'49'BB'13'31'11'EB;
+            return z ^ ( z >> 31 );
+        }
+    };
+
+    //   Runs one client.  Returns false if the connection failed or an answer was wrong.
+    bool run_client( const options& opts, std::size_t index, std::vector<double>& latencies )
+    {
+        auto client{ naming_client::connect( opts.socket.c_str() ) };
+        if( !client )
+        {
+            return false;
+        }
+
+        generator rng{ index + 1 };
+        std::vector<uint32_t> colors( opts.batch );
+        std::vector<std::string_view> names( opts.batch );
+        std::vector<color_id> ids( opts.batch );
+        std::vector<color_id> expected( opts.batch );
+        for( std::size_t r{ 0 }; r < opts.requests; ++r )
+        {
+            for( std::size_t i{ 0 }; i < opts.batch; ++i )
+            {
+                const auto& e{ table[rng.next() % color_count] };
+                colors[i] = opts.op == naming::operation::nearest ? static_cast<uint32_t>( rng.next() ) | 0xff : e.value;
+                names[i] = e.name;
+            }
+
+            const auto start{ std::chrono::steady_clock::now() };
+            const bool ok{ opts.op == naming::operation::find    ? client.find( names.data(), names.size(), ids.data() )
+                         : opts.op == naming::operation::name_of ? client.name_of( colors.data(), colors.size(), ids.data() )
+                                                                 : client.nearest( colors.data(), colors.size(), ids.data() ) };
+            const auto stop{ std::chrono::steady_clock::now() };
+            if( !ok )
+            {
+                return false;
+            }
+            latencies.push_back( std::chrono::duration<double, std::micro>( stop - start ).count() );
+
+            //   Check the first answers and every hundredth request after that.
+            if( r % 100 == 0 )
+            {
+                for( std::size_t i{ 0 }; i < opts.batch; ++i )
+                {
+                    expected[i] = opts.op == naming::operation::find ? find( names[i] ) : opts.op == naming::operation::name_of ? id_of( colors[i] ) : nearest( colors[i] );
+                }
+                if( ids != expected )
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+
+
+int main( int argc, char** argv )
+{
+    const auto opts{ parse( argc, argv ) };
+
+    std::vector<std::vector<double>> latencies( opts.clients );
+    std::atomic<std::size_t> failures{ 0 };
+    std::vector<std::thread> threads;
+    const auto start{ std::chrono::steady_clock::now() };
+    for( std::size_t i{ 0 }; i < opts.clients; ++i )
+    {
+        threads.emplace_back( [&opts, &latencies, &failures, i]
+        {
+            latencies[i].reserve( opts.requests );
+            if( !run_client( opts, i, latencies[i] ) )
+            {
+                ++failures;
+            }
+        } );
+    }
+    for( auto& thread : threads )
+    {
+        thread.join();
+    }
+    const double seconds{ std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count() };
+
+    if( failures > 0 )
+    {
+        std::fprintf( stderr, "%s: %zu of %zu clients failed (is naming_daemon running on %s?)\n",
+                      argv[0], failures.load(), opts.clients, opts.socket.c_str() );
+        return 1;
+    }
+
+    std::vector<double> all;
+    for( const auto& l : latencies )
+    {
+        all.insert( all.end(), l.begin(), l.end() );
+    }
+    std::sort( all.begin(), all.end() );
+    const auto percentile{ [&all]( double p )
+    {
+        return all[static_cast<std::size_t>( p * static_cast<double>( all.size() - 1 ) + 0.5 )];
+    } };
+
+    std::printf( "%zu clients x %zu requests x %zu items\n", opts.clients, opts.requests, opts.batch );
+    std::printf( "latency us    p50 %.1f    p99 %.1f    max %.1f\n", percentile( 0.5 ), percentile( 0.99 ), all.back() );
+    std::printf( "throughput    %.0f requests/s    %.0f items/s\n",
+                 static_cast<double>( all.size() ) / seconds, static_cast<double>( all.size() * opts.batch ) / seconds );
+    return 0;
+}
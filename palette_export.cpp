@@ -0,0 +1,49 @@
+//
+//   Writes the named color palette to a file (or stdout) in one of the formats of named_colors_export.h.  Meant to be
+// run from build steps that regenerate palette reference files.
+//
+//   Usage:  palette_export text|csv|json|hex [FILE]
+//
+// This file requires C++17.
+//
+
+
+#include "named_colors_export.h"
+
+
+
+#include<cstdio>
+#include<string_view>
+#include<utility>
+
+
+
+int main( int argc, char** argv )
+{
+    using named_colors::export_format;
+
+    constexpr std::pair<std::string_view, export_format> formats[]{
+        { "text", export_format::text },
+        { "csv",  export_format::csv },
+        { "json", export_format::json },
+        { "hex",  export_format::hex } };
+
+    if( argc == 2 || argc == 3 )
+    {
+        for( const auto& [name, format] : formats )
+        {
+            if( name == argv[1] )
+            {
+                if( named_colors::write_palette( format, argc == 3 ? argv[2] : nullptr ) )
+                {
+                    return 0;
+                }
+                std::fprintf( stderr, "%s: can't write %s\n", argv[0], argc == 3 ? argv[2] : "to stdout" );
+                return 1;
+            }
+        }
+    }
+
+    std::fprintf( stderr, "usage: %s text|csv|json|hex [FILE]\n", argv[0] );
+    return 2;
+}
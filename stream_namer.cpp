@@ -0,0 +1,171 @@
+//
+//   Writes the index image of a PPM, PAM or raw RGBA8 image's nearest named colors with named_colors_stream.h,
+// a chunk of rows at a time, so images of any size can be named in bounded memory.  - reads stdin or writes
+// stdout.  With --stats, prints the throughput to stderr.  With --check, also names IN with name_image() into a
+// temporary file next to OUT and exits with 1 unless the two index images are the same byte for byte; IN and OUT
+// have to be files for that.
+//
+//   Usage:  stream_namer [--rows N] [--depth N] [--threads N] [--raw WIDTHxHEIGHT] [--stats] [--check] IN OUT
+//
+// This file requires C++20.
+//
+
+
+#include "named_colors_image.h"
+#include "named_colors_stream.h"
+
+
+
+#include<chrono>
+#include<cstdio>
+#include<cstdlib>
+#include<string>
+#include<string_view>
+#include<vector>
+
+
+
+namespace
+{
+    std::vector<unsigned char> read_all( const char* path )
+    {
+        std::vector<unsigned char> bytes;
+        if( std::FILE* file{ std::fopen( path, "rb" ) } )
+        {
+            unsigned char buffer[65536];
+            for( std::size_t n{ std::fread( buffer, 1, sizeof( buffer ), file ) }; n > 0; n = std::fread( buffer, 1, sizeof( buffer ), file ) )
+            {
+                bytes.insert( bytes.end(), buffer, buffer + n );
+            }
+            std::fclose( file );
+        }
+        return bytes;
+    }
+
+    //   Names in with name_image() and compares the result with the stream's output.
+    bool check( const char* in, const char* out, const named_colors::stream_options& options )
+    {
+        const auto image{ options.raw_width != 0 ? named_colors::mapped_image::open_raw( in, options.raw_width, options.raw_height )
+                                                 : named_colors::mapped_image::open( in ) };
+        const std::string reference{ std::string{ out } + ".check" };
+        if( !named_colors::name_image( image, reference.c_str() ) )
+        {
+            std::fprintf( stderr, "check: name_image() can't name %s\n", in );
+            return false;
+        }
+        const auto expected{ read_all( reference.c_str() ) };
+        const auto got{ read_all( out ) };
+        std::remove( reference.c_str() );
+
+        std::size_t first{ 0 };
+        while( first < expected.size() && first < got.size() && expected[first] == got[first] )
+        {
+            ++first;
+        }
+        if( first < expected.size() || first < got.size() )
+        {
+            std::fprintf( stderr, "check: differs from name_image() at byte %zu of %zu\n", first, expected.size() );
+            return false;
+        }
+        std::fprintf( stderr, "check: same as name_image(), %zu bytes\n", got.size() );
+        return true;
+    }
+}
+
+
+
+int main( int argc, char** argv )
+{
+    named_colors::stream_options options;
+    bool stats{ false };
+    bool compare{ false };
+    const char* paths[2]{};
+    int path_count{ 0 };
+    bool usage{ false };
+    for( int i{ 1 }; i < argc && !usage; ++i )
+    {
+        const std::string_view arg{ argv[i] };
+        const bool has_value{ i + 1 < argc };
+        char* end{ nullptr };
+        if( arg == "--rows" && has_value )
+        {
+            options.rows_per_chunk = std::strtoul( argv[++i], &end, 10 );
+            usage = *end != '\0' || options.rows_per_chunk == 0;
+        }
+        else if( arg == "--depth" && has_value )
+        {
+            options.queue_depth = std::strtoul( argv[++i], &end, 10 );
+            usage = *end != '\0' || options.queue_depth == 0;
+        }
+        else if( arg == "--threads" && has_value )
+        {
+            options.threads = std::strtoul( argv[++i], &end, 10 );
+            usage = *end != '\0';
+        }
+        else if( arg == "--raw" && has_value )
+        {
+            options.raw_width = std::strtoul( argv[++i], &end, 10 );
+            usage = *end != 'x' || options.raw_width == 0;
+            if( !usage )
+            {
+                options.raw_height = std::strtoul( end + 1, &end, 10 );
+                usage = *end != '\0' || options.raw_height == 0;
+            }
+        }
+        else if( arg == "--stats" )
+        {
+            stats = true;
+        }
+        else if( arg == "--check" )
+        {
+            compare = true;
+        }
+        else if( path_count < 2 && ( arg == "-" || arg.substr( 0, 1 ) != "-" ) )
+        {
+            paths[path_count++] = argv[i];
+        }
+        else
+        {
+            usage = true;
+        }
+    }
+    const std::string_view stdio{ "-" };
+    if( usage || path_count != 2 || ( compare && ( paths[0] == stdio || paths[1] == stdio ) ) )
+    {
+        std::fprintf( stderr, "usage: %s [--rows N] [--depth N] [--threads N] [--raw WIDTHxHEIGHT] [--stats] [--check] IN OUT\n", argv[0] );
+        return 2;
+    }
+
+    std::FILE* in{ paths[0] == stdio ? stdin : std::fopen( paths[0], "rb" ) };
+    if( !in )
+    {
+        std::fprintf( stderr, "%s: can't read %s\n", argv[0], paths[0] );
+        return 1;
+    }
+    std::FILE* out{ paths[1] == stdio ? stdout : std::fopen( paths[1], "wb" ) };
+    if( !out )
+    {
+        std::fprintf( stderr, "%s: can't write %s\n", argv[0], paths[1] );
+        return 1;
+    }
+
+    const auto start{ std::chrono::steady_clock::now() };
+    const bool named{ named_colors::name_stream( in, out, options ) };
+    const double seconds{ std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count() };
+    const long read{ std::ftell( in ) };
+    const bool closed{ ( out == stdout || std::fclose( out ) == 0 ) };
+    if( in != stdin )
+    {
+        std::fclose( in );
+    }
+    if( !named || !closed )
+    {
+        std::fprintf( stderr, "%s: can't name %s into %s\n", argv[0], paths[0], paths[1] );
+        return 1;
+    }
+    if( stats && read > 0 )
+    {
+        std::fprintf( stderr, "%.0f MB in %.3f s, %.1f MB/s\n", read / 1e6, seconds, read / 1e6 / seconds );
+    }
+    return compare && !check( paths[0], paths[1], options ) ? 1 : 0;
+}
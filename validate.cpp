@@ -0,0 +1,393 @@
+//
+//   Differential check of the nearest named color searches.  Every accelerated search in the headers is run over
+// the same colors as a plain brute force scan of the whole of named_colors::table, and any disagreement, including
+// which of several equally close colors or aliases wins, is reported.  The exact membership tests are checked
+// against id_of() along the way.
+//
+//   By default it checks --random colors: random values, named colors and their neighbours, and midpoints of two
+// named colors, which are where ties happen.  --exhaustive checks every one of the 2^24 RGB values instead.  Work
+// is split over --threads threads (one per core by default), and the time each search took is reported, so the
+// run doubles as a throughput comparison.
+//
+//   Usage:  validate [--random N] [--exhaustive] [--threads N] [--seed N]
+//
+//   Exits with 1 if any search disagreed with the reference.
+//
+// This file requires C++17.
+//
+
+
+#include "named_colors_membership.h"
+#include "named_colors_palette.h"
+#include "named_colors_scheduler.h"
+#include "named_colors_table.h"
+
+
+
+#include<algorithm>
+#include<atomic>
+#include<chrono>
+#include<cstdint>
+#include<cstdio>
+#include<cstdlib>
+#include<mutex>
+#include<string_view>
+#include<thread>
+#include<vector>
+
+
+
+namespace
+{
+    using namespace named_colors;
+
+    constexpr std::size_t chunk_size{ 65536 };
+
+    //   splitmix64, so a seed always gives the same colors.
+    struct generator
+    {
+        uint64_t state;
+
+        uint64_t next()
+        {
+            uint64_t z{ state += 0x9E'37'79'B9'7F'4A'7C'15 };
+            z = ( z ^ ( z >> 30 ) ) * 0xBF'58'47'6D'1C'E4'E5'B9;
+            z = ( z ^ ( z >> 27 ) ) * 0x94'D0'49'BB'13'31'11'EB;
+            return z ^ ( z >> 31 );
+        }
+    };
+
+    //   The reference: every entry of the table, aliases included, lowest id on ties.
+    color_id brute_force( uint32_t color )
+    {
+        color_id best{ 0 };
+        uint32_t best_distance{ ~uint32_t{ 0 } };
+        for( std::size_t id{ 0 }; id < color_count; ++id )
+        {
+            const uint32_t distance{ distance_squared( color, table[id].value ) };
+            if( distance < best_distance )
+            {
+                best = static_cast<color_id>( id );
+                best_distance = distance;
+            }
+        }
+        return best;
+    }
+
+    //   Chunk k of the random colors, with random alpha throughout since every search has to ignore it.
+    void random_chunk( uint64_t seed, std::size_t chunk, std::vector<uint32_t>& colors )
+    {
+        generator rng{ seed ^ ( chunk * 0xD1'B5'4A'32'D1'92'ED'03 ) };
+        for( auto& color : colors )
+        {
+            const uint64_t r{ rng.next() };
+            const auto alpha{ static_cast<uint8_t>( r >> 56 ) };
+            const uint32_t a{ table[( r >> 8 ) % color_count].value };
+            const uint32_t b{ table[( r >> 24 ) % color_count].value };
+            switch( r & 3 )
+            {
+            case 0:
+                color = static_cast<uint32_t>( rng.next() );
+                break;
+            case 1:
+                color = a;
+                break;
+            case 2:
+            {
+                //   A named color moved by up to 2 in each channel.
+                const auto jitter{ [&r]( uint8_t c, int shift )
+                {
+                    return static_cast<uint8_t>( std::clamp( c + static_cast<int>( ( r >> shift ) % 5 ) - 2, 0, 255 ) );
+                } };
+                color = rgba( jitter( red( a ), 32 ), jitter( green( a ), 40 ), jitter( blue( a ), 48 ) );
+                break;
+            }
+            default:
+                color = rgba( static_cast<uint8_t>( ( red( a ) + red( b ) ) / 2 ), static_cast<uint8_t>( ( green( a ) + green( b ) ) / 2 ),
+                              static_cast<uint8_t>( ( blue( a ) + blue( b ) ) / 2 ) );
+                break;
+            }
+            color = ( color & 0xFF'FF'FF'00 ) | alpha;
+        }
+    }
+
+    void exhaustive_chunk( std::size_t chunk, std::vector<uint32_t>& colors )
+    {
+        for( std::size_t i{ 0 }; i < colors.size(); ++i )
+        {
+            const auto rgb{ static_cast<uint32_t>( chunk * chunk_size + i ) };
+            colors[i] = rgb << 8 | ( ( rgb * 0x9E'37'79'B1 ) >> 24 );
+        }
+    }
+
+    struct backend
+    {
+        std::string_view name;
+        void ( *search )( const uint32_t* colors, std::size_t count, uint8_t* scratch, color_id* ids );
+    };
+
+    const palette<canonical_count>& canonical_palette()
+    {
+        static const palette<canonical_count> all{ canonical_values };
+        return all;
+    }
+
+    //   Tiles that aren't a multiple of the 64 color blocks, so the scheduler's tile edges get checked too.  One
+    // per worker thread: run() takes one batch at a time, so with a shared scheduler the time measured would
+    // include waiting for the other workers' batches.
+    work_stealing_scheduler& scheduler()
+    {
+        static thread_local work_stealing_scheduler own{ 2, 1000 };
+        return own;
+    }
+
+    constexpr backend backends[]{
+        { "scalar", []( const uint32_t* colors, std::size_t count, uint8_t*, color_id* ids )
+        {
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                ids[i] = nearest( colors[i] );
+            }
+        } },
+        { "bulk", []( const uint32_t* colors, std::size_t count, uint8_t*, color_id* ids )
+        {
+            nearest( colors, count, ids );
+        } },
+        { "bulk/rgba8", []( const uint32_t* colors, std::size_t count, uint8_t* scratch, color_id* ids )
+        {
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                scratch[i * 4 + 0] = red( colors[i] );
+                scratch[i * 4 + 1] = green( colors[i] );
+                scratch[i * 4 + 2] = blue( colors[i] );
+                scratch[i * 4 + 3] = alpha( colors[i] );
+            }
+            nearest( scratch, count, 4, ids );
+        } },
+        { "scheduler", []( const uint32_t* colors, std::size_t count, uint8_t*, color_id* ids )
+        {
+            const image_span image{ colors, count };
+            nearest( scheduler(), &image, 1, &ids );
+        } },
+        { "palette/nearest", []( const uint32_t* colors, std::size_t count, uint8_t*, color_id* ids )
+        {
+            const auto& all{ canonical_palette() };
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                ids[i] = all.id( all.nearest( colors[i] ) );
+            }
+        } },
+        { "palette/quantize", []( const uint32_t* colors, std::size_t count, uint8_t* scratch, color_id* ids )
+        {
+            const auto& all{ canonical_palette() };
+            auto* indices{ reinterpret_cast<palette<canonical_count>::index_type*>( scratch ) };
+            all.quantize( colors, count, indices );
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                ids[i] = all.id( indices[i] );
+            }
+        } } };
+
+    constexpr std::size_t backend_count{ sizeof( backends ) / sizeof( backends[0] ) };
+
+    struct mismatch
+    {
+        std::string_view backend;
+        uint32_t         color;
+        color_id         expected;
+        color_id         got;
+    };
+
+    struct totals
+    {
+        std::mutex            mutex;
+        std::vector<mismatch> examples;
+        std::size_t           mismatches[backend_count + 1]{};     //  The last is the membership tests.
+        double                seconds[backend_count + 1]{};        //  The last is the reference.
+        std::size_t           named{ 0 };
+        std::size_t           bloom_false_positives{ 0 };
+
+        void report( std::string_view backend, uint32_t color, color_id expected, color_id got )
+        {
+            if( examples.size() < 16 )
+            {
+                examples.push_back( { backend, color, expected, got } );
+            }
+        }
+    };
+
+    void check_chunk( const std::vector<uint32_t>& colors, totals& total, std::vector<uint8_t>& scratch,
+                      std::vector<color_id>& expected, std::vector<color_id>& got )
+    {
+        const std::size_t count{ colors.size() };
+        double seconds[backend_count + 1]{};
+        std::size_t mismatches[backend_count + 1]{};
+        std::vector<mismatch> examples;
+
+        auto start{ std::chrono::steady_clock::now() };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            expected[i] = brute_force( colors[i] );
+        }
+        seconds[backend_count] = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+        for( std::size_t b{ 0 }; b < backend_count; ++b )
+        {
+            start = std::chrono::steady_clock::now();
+            backends[b].search( colors.data(), count, scratch.data(), got.data() );
+            seconds[b] = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+            for( std::size_t i{ 0 }; i < count; ++i )
+            {
+                if( got[i] != expected[i] )
+                {
+                    ++mismatches[b];
+                    if( examples.size() < 16 )
+                    {
+                        examples.push_back( { backends[b].name, colors[i], expected[i], got[i] } );
+                    }
+                }
+            }
+        }
+
+        //   Membership: is_named() has to agree with id_of(), may_be_named() may only err towards true.
+        std::size_t named{ 0 };
+        std::size_t false_positives{ 0 };
+        for( std::size_t i{ 0 }; i < count; ++i )
+        {
+            const auto id{ id_of( colors[i] ) };
+            const bool exact{ id != no_color && ( table[id].value >> 8 ) == ( colors[i] >> 8 ) };
+            const bool maybe{ may_be_named( colors[i] ) };
+            named += exact;
+            false_positives += maybe && !exact;
+            if( is_named( colors[i] ) != exact || ( exact && !maybe ) || ( id != no_color && !exact ) )
+            {
+                ++mismatches[backend_count];
+                if( examples.size() < 16 )
+                {
+                    examples.push_back( { "membership", colors[i], no_color, id } );
+                }
+            }
+        }
+
+        std::lock_guard lock{ total.mutex };
+        for( std::size_t b{ 0 }; b <= backend_count; ++b )
+        {
+            total.seconds[b] += seconds[b];
+            total.mismatches[b] += mismatches[b];
+        }
+        for( const auto& m : examples )
+        {
+            total.report( m.backend, m.color, m.expected, m.got );
+        }
+        total.named += named;
+        total.bloom_false_positives += false_positives;
+    }
+
+    std::string_view name_or_none( color_id id )
+    {
+        return id < color_count ? table[id].name : std::string_view{ "-" };
+    }
+}
+
+
+
+int main( int argc, char** argv )
+{
+    std::size_t random_count{ 4'000'000 };
+    bool exhaustive{ false };
+    std::size_t threads{ std::max( 1u, std::thread::hardware_concurrency() ) };
+    uint64_t seed{ 1 };
+    for( int i{ 1 }; i < argc; ++i )
+    {
+        const std::string_view arg{ argv[i] };
+        const bool has_value{ i + 1 < argc };
+        if( arg == "--random" && has_value )
+        {
+            random_count = std::strtoull( argv[++i], nullptr, 10 );
+        }
+        else if( arg == "--exhaustive" )
+        {
+            exhaustive = true;
+        }
+        else if( arg == "--threads" && has_value )
+        {
+            threads = std::max<std::size_t>( 1, std::strtoul( argv[++i], nullptr, 10 ) );
+        }
+        else if( arg == "--seed" && has_value )
+        {
+            seed = std::strtoull( argv[++i], nullptr, 10 );
+        }
+        else
+        {
+            std::fprintf( stderr, "usage: %s [--random N] [--exhaustive] [--threads N] [--seed N]\n", argv[0] );
+            return 2;
+        }
+    }
+
+    const std::size_t colors{ exhaustive ? std::size_t{ 1 } << 24 : random_count };
+    const std::size_t chunks{ ( colors + chunk_size - 1 ) / chunk_size };
+    std::printf( "%s: %zu colors in %zu chunks on %zu threads\n", exhaustive ? "exhaustive" : "random", colors, chunks, threads );
+
+    canonical_palette();
+    totals total;
+    std::atomic<std::size_t> next_chunk{ 0 };
+    const auto start{ std::chrono::steady_clock::now() };
+    std::vector<std::thread> workers;
+    for( std::size_t t{ 0 }; t < threads; ++t )
+    {
+        workers.emplace_back( [&]
+        {
+            scheduler();
+            std::vector<uint32_t> chunk_colors;
+            std::vector<uint8_t> scratch( chunk_size * 4 );
+            std::vector<color_id> expected( chunk_size );
+            std::vector<color_id> got( chunk_size );
+            for( std::size_t chunk{ next_chunk++ }; chunk < chunks; chunk = next_chunk++ )
+            {
+                chunk_colors.resize( std::min( chunk_size, colors - chunk * chunk_size ) );
+                if( exhaustive )
+                {
+                    exhaustive_chunk( chunk, chunk_colors );
+                }
+                else
+                {
+                    random_chunk( seed, chunk, chunk_colors );
+                }
+                check_chunk( chunk_colors, total, scratch, expected, got );
+            }
+        } );
+    }
+    for( auto& worker : workers )
+    {
+        worker.join();
+    }
+    const double wall{ std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count() };
+
+    std::printf( "\n%-20s %12s %14s\n", "search", "mismatches", "ns/color" );
+    const auto row{ [&]( std::string_view name, std::size_t mismatches, double seconds )
+    {
+        std::printf( "%-20.*s %12zu %14.2f\n", static_cast<int>( name.size() ), name.data(), mismatches,
+                     seconds * 1e9 / static_cast<double>( colors ) );
+    } };
+    row( "reference", 0, total.seconds[backend_count] );
+    for( std::size_t b{ 0 }; b < backend_count; ++b )
+    {
+        row( backends[b].name, total.mismatches[b], total.seconds[b] );
+    }
+    std::printf( "%-20s %12zu %14s\n", "membership", total.mismatches[backend_count], "-" );
+    std::printf( "\n%zu named, %zu Bloom filter false positives, %.1f s wall\n", total.named, total.bloom_false_positives, wall );
+
+    for( const auto& m : total.examples )
+    {
+        std::printf( "%.*s: #%08X expected %.*s, got %.*s\n", static_cast<int>( m.backend.size() ), m.backend.data(), m.color,
+                     static_cast<int>( name_or_none( m.expected ).size() ), name_or_none( m.expected ).data(),
+                     static_cast<int>( name_or_none( m.got ).size() ), name_or_none( m.got ).data() );
+    }
+
+    std::size_t failures{ 0 };
+    for( const auto m : total.mismatches )
+    {
+        failures += m;
+    }
+    return failures == 0 ? 0 : 1;
+}